@@ -0,0 +1,86 @@
+/**
+* @date 17.10.26
+* @brief Micro-benchmark for the search of replacement watchers
+* @details Scans clauses of different lengths in which only the last literal is not falsified, which is the worst
+* case of the replacement watcher search in Solver::unitPropagate. Compares the scalar and the AVX2 scan.
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "literal_scan.hpp"
+#include "util/Profiler.hpp"
+
+namespace {
+    constexpr std::uint32_t NumLiterals = 1u << 20;
+    constexpr std::size_t NumClauses = 1024;
+
+    /**
+     * Measures the average time per scanned clause
+     * @param scan scan implementation
+     * @param clauses literals of all clauses, stored consecutively
+     * @param length clause length
+     * @param values literal values
+     * @return average time per clause in ns
+     */
+    double measure(sat::detail::ScanFunction scan, const std::vector<std::uint32_t> &clauses, std::size_t length,
+                   const std::vector<std::int8_t> &values) {
+        constexpr unsigned Repetitions = 200;
+        std::size_t checksum = 0;
+        sat::StopWatch watch;
+        for (unsigned rep = 0; rep < Repetitions; ++rep) {
+            for (std::size_t c = 0; c < NumClauses; ++c) {
+                checksum += scan(clauses.data() + c * length, length, values.data());
+            }
+        }
+
+        const auto elapsed = watch.elapsed<std::chrono::nanoseconds>();
+        if (checksum != Repetitions * NumClauses * (length - 1)) {
+            std::cerr << "wrong scan result" << std::endl;
+            std::exit(1);
+        }
+
+        return static_cast<double>(elapsed) / (Repetitions * NumClauses);
+    }
+}
+
+int main() {
+    using namespace sat;
+    std::mt19937 rng(42);
+    // literals with even ids are false, odd ids are true
+    std::vector<std::int8_t> values(NumLiterals + ScanPadding, 0);
+    for (std::uint32_t id = 0; id < NumLiterals; ++id) {
+        values[id] = id % 2 == 0 ? -1 : 1;
+    }
+
+    const bool vector = detail::hasVectorScan();
+    if (not vector) {
+        std::cout << "AVX2 is not supported, only the scalar scan is measured" << std::endl;
+    }
+
+    std::cout << std::setw(8) << "length" << std::setw(16) << "scalar [ns]" << std::setw(16) << "avx2 [ns]"
+              << std::setw(12) << "speedup" << std::endl;
+    for (std::size_t length = 4; length <= 512; length *= 2) {
+        std::vector<std::uint32_t> clauses(NumClauses * length);
+        for (std::size_t i = 0; i < clauses.size(); ++i) {
+            const auto id = static_cast<std::uint32_t>(rng() % NumLiterals);
+            clauses[i] = (i + 1) % length == 0 ? id | 1u : id & ~1u;
+        }
+
+        const auto scalar = measure(detail::findNonFalsifiedScalar, clauses, length, values);
+        std::cout << std::setw(8) << length << std::setw(16) << std::fixed << std::setprecision(1) << scalar;
+#ifdef SAT_HAS_AVX2_SCAN
+        if (vector) {
+            const auto avx2 = measure(detail::findNonFalsifiedAvx2, clauses, length, values);
+            std::cout << std::setw(16) << avx2 << std::setw(12) << std::setprecision(2) << scalar / avx2;
+        }
+#endif
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+/**
+* @date 17.10.26
+* @brief Micro-benchmark for propagation over long watch lists
+* @details All clauses watch the same literal. Falsifying it moves every watcher to another literal, so the cost of
+* a single watcher move dominates the runtime. With constant cost moves, the time per watcher stays flat when the
+* watch list grows.
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+
+#include "Solver.hpp"
+#include "util/Profiler.hpp"
+
+namespace {
+    /**
+     * Creates a solver where n ternary clauses (x0 ∨ y_i ∨ z_i) all watch x0
+     * @param n number of clauses
+     * @return solver
+     */
+    sat::Solver makeSolver(unsigned n) {
+        using namespace sat;
+        Solver solver(2 * n + 1);
+        for (unsigned i = 0; i < n; ++i) {
+            solver.addClause(Clause({pos(0), pos(2 * i + 1), pos(2 * i + 2)}));
+        }
+
+        return solver;
+    }
+}
+
+int main() {
+    using namespace sat;
+    constexpr unsigned Repetitions = 5;
+    std::cout << std::setw(12) << "watchers" << std::setw(16) << "total [µs]" << std::setw(20) << "per watcher [ns]"
+              << std::endl;
+    for (unsigned n = 1024; n <= (1u << 17); n *= 2) {
+        long long total = 0;
+        for (unsigned rep = 0; rep < Repetitions; ++rep) {
+            auto solver = makeSolver(n);
+            solver.assign(neg(0));
+            StopWatch watch;
+            if (not solver.unitPropagate()) {
+                std::cerr << "unexpected conflict" << std::endl;
+                return 1;
+            }
+
+            total += watch.elapsed<std::chrono::nanoseconds>();
+        }
+
+        const auto avg = total / Repetitions;
+        std::cout << std::setw(12) << n << std::setw(16) << avg / 1000 << std::setw(20)
+                  << static_cast<double>(avg) / n << std::endl;
+    }
+
+    return 0;
+}
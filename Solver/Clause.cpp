@@ -15,21 +15,12 @@
 namespace sat {
 // TODO implementation here
 
-Clause::Clause(std::vector<Literal> literals) {
-    // assert(literals.size() > 0);
-    this->literals = literals;
-    watchers[0] = 0;
-    if (literals.size() >= 2) {
-       watchers[1] = 1;
-    } else {
-        watchers[1] = 0;
-    }
-}
+Clause::Clause(std::vector<Literal> literals) : literals(std::move(literals)) {}
 
 short Clause::getRank(Literal l) const {
-    if (literals[watchers[0]] == l) {
+    if (literals.size() > 0 && literals[0] == l) {
         return 0;
-    } else if (literals[watchers[1]] == l) {
+    } else if (literals.size() > 1 && literals[1] == l) {
         return 1;
     } else {
         return -1;
@@ -38,19 +29,19 @@ short Clause::getRank(Literal l) const {
 
 std::size_t Clause::getIndex(short rank) const {
     assert(rank == 0 || rank == 1);
-    return watchers[rank];
+    return literals.size() > 1 ? rank : 0;
 }
 
 bool Clause::setWatcher(Literal l, short watcherNo) {
     assert(watcherNo == 0 || watcherNo == 1);
 
-    for (unsigned i = 0; i < literals.size(); i++) {
-        if (literals[i] == l) {
-            watchers[watcherNo] = i;
-            return true;
-        }
+    auto res = std::ranges::find(literals, l);
+    if (res == literals.end() || literals.size() <= std::size_t(watcherNo)) {
+        return false;
     }
-    return false;
+
+    std::iter_swap(res, literals.begin() + watcherNo);
+    return true;
 }
 
 auto Clause::begin() const -> std::vector<Literal>::const_iterator {
@@ -68,8 +59,7 @@ Literal Clause::operator[](std::size_t index) const { return literals[index]; }
 std::size_t Clause::size() const { return literals.size(); }
 
 Literal Clause::getWatcherByRank(short rank) const {
-    assert(rank == 0 || rank == 1);
-    return literals[watchers[rank]];
+    return literals[getIndex(rank)];
 }
 
 bool Clause::sameLiterals(const Clause &other) const {
@@ -31,6 +31,7 @@ namespace sat {
     /**
      * @brief Clause class with watch literals.
      * @details @copybrief
+     * The watch literals are always stored at positions 0 and 1. Setting a watcher swaps the literal into place.
      * In order for it to model the clause_like concept, you must implement
      * the begin() and end() member functions. I recommend that you store the Literals in a private member of type
      * std::vector<Literal>. Then, to implement begin() and end(), you can simply return the iterators returned from
@@ -39,7 +40,6 @@ namespace sat {
     class Clause {
         // @TODO Private members here
         std::vector<Literal> literals;
-        size_t watchers[2];
     public:
 
         /**
@@ -69,14 +69,14 @@ namespace sat {
         short getRank(Literal l) const;
 
         /**
-         * Gets the index of the watcher with the given rank
+         * Gets the index of the watcher with the given rank. Watchers are always at the first two positions
          * @param rank rank of the watcher
          * @return first watcher index if rank is 0, second watcher index otherwise
          */
         std::size_t getIndex(short rank) const;
 
         /**
-         * Sets the given literal as watcher
+         * Sets the given literal as watcher by swapping it to the position of the watcher
          * @param l Literal to be the new watcher
          * @param watcherNo number of the watcher to be replaced
          * @return true if setting watcher was successful, false if literal is not contained in clause
@@ -0,0 +1,76 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include <limits>
+#include <stdexcept>
+
+#include "ClauseArena.hpp"
+
+namespace sat {
+
+    std::size_t ClauseArena::size() const noexcept {
+        return memory.size();
+    }
+
+    std::size_t ClauseArena::wasted() const noexcept {
+        return wastedWords;
+    }
+
+    void ClauseArena::reserve(std::size_t words) {
+        memory.reserve(words);
+    }
+
+    void ClauseArena::free(ClauseRef ref) noexcept {
+        assert(not (*this)[ref].isDeleted());
+        memory[ref + detail::FlagsWord] |= ClauseFlags::Deleted;
+        wastedWords += detail::HeaderSize + memory[ref + detail::SizeWord];
+    }
+
+    void ClauseArena::removeLiteral(ClauseRef ref, std::size_t index) noexcept {
+        auto *header = memory.data() + ref;
+        const auto size = header[detail::SizeWord];
+        assert(not (header[detail::FlagsWord] & ClauseFlags::Deleted));
+        assert(index < size && size > 2);
+        header[detail::HeaderSize + index] = header[detail::HeaderSize + size - 1];
+        header[detail::SizeWord] = size - 1;
+        if (header[detail::SearchPosWord] >= size - 1) {
+            header[detail::SearchPosWord] = 2;
+        }
+
+        ++wastedWords;
+    }
+
+    ClauseRef ClauseArena::relocate(ClauseRef ref, ClauseArena &to) {
+        auto *header = memory.data() + ref;
+        if (header[detail::FlagsWord] & ClauseFlags::Relocated) {
+            return header[detail::ForwardWord];
+        }
+
+        assert(not (header[detail::FlagsWord] & ClauseFlags::Deleted));
+        const auto words = detail::HeaderSize + header[detail::SizeWord];
+        if (to.memory.size() + words > std::numeric_limits<ClauseRef>::max()) {
+            throw std::length_error("clause arena exceeds the 32 bit address space");
+        }
+
+        const auto newRef = static_cast<ClauseRef>(to.memory.size());
+        to.memory.insert(to.memory.end(), header, header + words);
+        header[detail::FlagsWord] |= ClauseFlags::Relocated;
+        header[detail::ForwardWord] = newRef;
+        return newRef;
+    }
+
+    ClauseRef ClauseArena::allocHeader(bool learnt) {
+        if (memory.size() + detail::HeaderSize > std::numeric_limits<ClauseRef>::max()) {
+            throw std::length_error("clause arena exceeds the 32 bit address space");
+        }
+
+        const auto ref = static_cast<ClauseRef>(memory.size());
+        memory.resize(memory.size() + detail::HeaderSize, 0);
+        memory[ref + detail::FlagsWord] = learnt ? std::uint32_t(ClauseFlags::Learnt) : 0u;
+        memory[ref + detail::ActivityWord] = std::bit_cast<std::uint32_t>(0.0f);
+        memory[ref + detail::SearchPosWord] = 2;
+        return ref;
+    }
+}
@@ -0,0 +1,379 @@
+/**
+* @date 17.10.26
+* @file ClauseArena.hpp
+* @brief Contains the contiguous clause storage of the solver
+*/
+
+#ifndef CLAUSEARENA_HPP
+#define CLAUSEARENA_HPP
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "basic_structures.hpp"
+#include "Clause.hpp"
+
+namespace sat {
+
+    /**
+     * Reference to a clause stored in a ClauseArena. This is the offset of the clause header in the arena
+     */
+    using ClauseRef = std::uint32_t;
+
+    /**
+     * @brief Flags stored in the clause header
+     */
+    enum ClauseFlags : std::uint32_t {
+        Learnt = 1u << 0,    ///< clause was learned during search
+        Deleted = 1u << 1,   ///< clause was removed, its memory is reclaimed by the next garbage collection
+        Relocated = 1u << 2, ///< clause was moved to another arena, the header holds the new reference
+        Used = 1u << 3,      ///< learned clause took part in conflict analysis since the last clause database reduction
+    };
+
+    namespace detail {
+        /**
+         * @brief Layout of the clause header. Each entry is the offset of a 32 bit word
+         */
+        enum HeaderWord : std::size_t {
+            SizeWord = 0,     ///< number of literals
+            FlagsWord = 1,    ///< ClauseFlags in the lowest byte, literal block distance in the upper bits
+            ActivityWord = 2, ///< clause activity (float)
+            SearchPosWord = 3, ///< position where the last search for a replacement watcher stopped
+            HeaderSize = 4,
+            ForwardWord = ActivityWord ///< new reference of a relocated clause
+        };
+
+        constexpr unsigned LbdShift = 8;
+        constexpr std::uint32_t FlagMask = (1u << LbdShift) - 1;
+    }
+
+    /**
+     * @brief Iterator over the literals of a clause stored in a ClauseArena
+     */
+    class LiteralIterator {
+        const std::uint32_t *pos = nullptr;
+    public:
+        using value_type = Literal;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        LiteralIterator() = default;
+
+        explicit LiteralIterator(const std::uint32_t *pos) noexcept : pos(pos) {}
+
+        Literal operator*() const noexcept {
+            return *pos;
+        }
+
+        LiteralIterator &operator++() noexcept {
+            ++pos;
+            return *this;
+        }
+
+        LiteralIterator operator++(int) noexcept {
+            auto tmp = *this;
+            ++pos;
+            return tmp;
+        }
+
+        bool operator==(const LiteralIterator &other) const noexcept = default;
+    };
+
+    /**
+     * @brief Non owning handle to a clause stored in a ClauseArena.
+     * @details @copybrief
+     * Models clause_like. The handle is invalidated when the arena grows.
+     * @tparam Word std::uint32_t for a mutable view, const std::uint32_t for a read-only view
+     */
+    template<typename Word>
+    class BasicClauseView {
+        Word *data;
+
+        static constexpr bool Mutable = not std::is_const_v<Word>;
+    public:
+        /**
+         * CTor
+         * @param data pointer to the clause header
+         */
+        explicit BasicClauseView(Word *data) noexcept : data(data) {}
+
+        /**
+         * Conversion from mutable to read-only view
+         */
+        operator BasicClauseView<const std::uint32_t>() const noexcept {
+            return BasicClauseView<const std::uint32_t>(data);
+        }
+
+        /**
+         * size of the clause
+         * @return
+         */
+        std::size_t size() const noexcept {
+            return data[detail::SizeWord];
+        }
+
+        /**
+         * Array subscript operator
+         * @param index index for access
+         * @return Literal at given index
+         */
+        Literal operator[](std::size_t index) const noexcept {
+            assert(index < size());
+            return data[detail::HeaderSize + index];
+        }
+
+        /**
+         * Raw literal identifiers of the clause
+         * @return pointer to the identifier of the first literal, followed by size() - 1 further identifiers
+         */
+        const std::uint32_t *literals() const noexcept {
+            return data + detail::HeaderSize;
+        }
+
+        /**
+         * Iterator to first Literal in the clause
+         * @return
+         */
+        LiteralIterator begin() const noexcept {
+            return LiteralIterator(data + detail::HeaderSize);
+        }
+
+        /**
+         * Past-the-end iterator
+         * @return
+         */
+        LiteralIterator end() const noexcept {
+            return LiteralIterator(data + detail::HeaderSize + size());
+        }
+
+        /**
+         * Whether the clause was learned during search
+         * @return
+         */
+        bool isLearnt() const noexcept {
+            return data[detail::FlagsWord] & ClauseFlags::Learnt;
+        }
+
+        /**
+         * Whether the clause was removed
+         * @return
+         */
+        bool isDeleted() const noexcept {
+            return data[detail::FlagsWord] & ClauseFlags::Deleted;
+        }
+
+        /**
+         * Whether the clause was used in conflict analysis since the flag was last cleared
+         * @return
+         */
+        bool isUsed() const noexcept {
+            return data[detail::FlagsWord] & ClauseFlags::Used;
+        }
+
+        /**
+         * Literal block distance of the clause
+         * @return
+         */
+        unsigned getLbd() const noexcept {
+            return data[detail::FlagsWord] >> detail::LbdShift;
+        }
+
+        /**
+         * Activity of the clause
+         * @return
+         */
+        float getActivity() const noexcept {
+            return std::bit_cast<float>(data[detail::ActivityWord]);
+        }
+
+        /**
+         * Gets the watcher rank of the given Literal. The watchers are the literals at positions 0 and 1
+         * @param l
+         * @return 0 if first watcher, 1 if second watcher, -1 if no watcher
+         */
+        short getRank(Literal l) const noexcept {
+            if ((*this)[0] == l) {
+                return 0;
+            } else if ((*this)[1] == l) {
+                return 1;
+            }
+
+            return -1;
+        }
+
+        /**
+         * Get the watch literal identified by the given rank
+         * @param rank rank of the watcher in {0, 1}
+         * @return watch literal
+         */
+        Literal getWatcherByRank(short rank) const noexcept {
+            assert(rank == 0 || rank == 1);
+            return (*this)[rank];
+        }
+
+        /**
+         * Gets the position from which the search for a replacement watcher is resumed
+         * @return position in [2, size()) for clauses with more than two literals
+         */
+        std::size_t getSearchPos() const noexcept {
+            return data[detail::SearchPosWord];
+        }
+
+        /**
+         * Swaps two literals of the clause. Swapping a literal to position 0 or 1 makes it a watcher
+         * @param i index of the first literal
+         * @param j index of the second literal
+         */
+        void swap(std::size_t i, std::size_t j) noexcept requires Mutable {
+            assert(i < size() && j < size());
+            std::swap(data[detail::HeaderSize + i], data[detail::HeaderSize + j]);
+        }
+
+        /**
+         * Sets the position from which the next search for a replacement watcher starts
+         * @param pos position in [2, size())
+         */
+        void setSearchPos(std::size_t pos) noexcept requires Mutable {
+            assert(pos >= 2 && pos < size());
+            data[detail::SearchPosWord] = static_cast<std::uint32_t>(pos);
+        }
+
+        /**
+         * Sets or clears the used flag
+         * @param used
+         */
+        void setUsed(bool used) noexcept requires Mutable {
+            if (used) {
+                data[detail::FlagsWord] |= ClauseFlags::Used;
+            } else {
+                data[detail::FlagsWord] &= ~static_cast<std::uint32_t>(ClauseFlags::Used);
+            }
+        }
+
+        /**
+         * Sets the literal block distance
+         * @param lbd
+         */
+        void setLbd(unsigned lbd) noexcept requires Mutable {
+            data[detail::FlagsWord] = (data[detail::FlagsWord] & detail::FlagMask) | (lbd << detail::LbdShift);
+        }
+
+        /**
+         * Sets the activity
+         * @param activity
+         */
+        void setActivity(float activity) noexcept requires Mutable {
+            data[detail::ActivityWord] = std::bit_cast<std::uint32_t>(activity);
+        }
+    };
+
+    using ClauseView = BasicClauseView<std::uint32_t>;
+    using ConstClauseView = BasicClauseView<const std::uint32_t>;
+
+    /**
+     * @brief Contiguous storage for clauses.
+     * @details @copybrief
+     * All clauses live in a single buffer of 32 bit words. Each clause consists of a header (see detail::HeaderWord)
+     * directly followed by its literals. Clauses are addressed by their offset in the buffer (ClauseRef).
+     */
+    class ClauseArena {
+        std::vector<std::uint32_t> memory;
+        std::size_t wastedWords = 0;
+    public:
+        ClauseArena() = default;
+
+        /**
+         * Stores a clause in the arena. The first two literals are the watchers
+         * @param literals literals of the clause, must contain at least two literals and must not refer to a clause
+         * stored in this arena
+         * @param learnt whether the clause is a learned clause
+         * @return reference to the new clause
+         * @throws std::length_error if the arena exceeds the 32 bit address space
+         */
+        template<clause_like C>
+        ClauseRef alloc(const C &literals, bool learnt = false) {
+            const auto ref = allocHeader(learnt);
+            std::uint32_t size = 0;
+            for (Literal l : literals) {
+                memory.emplace_back(l.get());
+                ++size;
+            }
+
+            assert(size >= 2);
+            memory[ref + detail::SizeWord] = size;
+            return ref;
+        }
+
+        /**
+         * Gets a mutable handle to a stored clause
+         * @param ref clause reference
+         * @return clause handle
+         */
+        ClauseView operator[](ClauseRef ref) noexcept {
+            assert(ref < memory.size());
+            return ClauseView(memory.data() + ref);
+        }
+
+        /**
+         * Gets a read-only handle to a stored clause
+         * @param ref clause reference
+         * @return clause handle
+         */
+        ConstClauseView operator[](ClauseRef ref) const noexcept {
+            assert(ref < memory.size());
+            return ConstClauseView(memory.data() + ref);
+        }
+
+        /**
+         * Marks a clause as deleted. Its memory is counted as wasted until the arena is compacted
+         * @param ref clause reference
+         */
+        void free(ClauseRef ref) noexcept;
+
+        /**
+         * Removes a literal from a clause by moving the last literal to its position. The freed word is counted as
+         * wasted until the arena is compacted
+         * @param ref clause reference
+         * @param index index of the literal to remove, the clause must keep at least two literals
+         */
+        void removeLiteral(ClauseRef ref, std::size_t index) noexcept;
+
+        /**
+         * Moves a clause to another arena. The old location keeps a forwarding reference, so relocating the same
+         * clause again yields the same new reference.
+         * @param ref reference of a clause that is not deleted
+         * @param to target arena
+         * @return reference of the clause in the target arena
+         */
+        ClauseRef relocate(ClauseRef ref, ClauseArena &to);
+
+        /**
+         * Reserves memory
+         * @param words number of 32 bit words
+         */
+        void reserve(std::size_t words);
+
+        /**
+         * Number of 32 bit words in use
+         * @return
+         */
+        std::size_t size() const noexcept;
+
+        /**
+         * Number of 32 bit words occupied by deleted clauses
+         * @return
+         */
+        std::size_t wasted() const noexcept;
+
+    private:
+        ClauseRef allocHeader(bool learnt);
+    };
+}
+
+#endif //CLAUSEARENA_HPP
@@ -9,157 +9,968 @@
 #include "basic_structures.hpp"
 #include "printing.hpp"
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <concepts>
 #include <cstddef>
 #include <iostream>
 #include <memory>
+#include <optional>
+#include <span>
 #include <utility>
+#include <variant>
 #include <vector>
+#include "clause_set.hpp"
+#include "equivalences.hpp"
 #include "heuristics.hpp"
+#include "literal_scan.hpp"
+#include "subsumption.hpp"
+#include "util/assert.hpp"
 
 namespace sat {
 
-Assignments::Assignments(unsigned numVariables) {
-    assignments = std::vector<TruthValue>(numVariables, TruthValue::Undefined);
+Reason Reason::clause(ClauseRef ref) {
+    Reason reason;
+    reason.data = ref;
+    reason.kind = Kind::Clause;
+    return reason;
 }
 
+Reason Reason::binary(Literal other) {
+    Reason reason;
+    reason.data = other.get();
+    reason.kind = Kind::Binary;
+    return reason;
+}
+
+Reason::Kind Reason::getKind() const { return kind; }
+
+ClauseRef Reason::getClause() const {
+    assert(kind == Kind::Clause);
+    return data;
+}
+
+Literal Reason::getLiteral() const {
+    assert(kind == Kind::Binary);
+    return data;
+}
+
+Assignments::Assignments(unsigned numVariables)
+    : assignments(numVariables, TruthValue::Undefined),
+      literalValues(2 * std::size_t(numVariables) + ScanPadding, 0),
+      levels(numVariables, 0), reasons(numVariables),
+      trailPositions(numVariables, 0) {}
+
 TruthValue Assignments::operator[](Variable var) const {
     return assignments[size_t(var.get())];
 }
 
 void Assignments::set(Variable var, TruthValue value) {
     assignments[size_t(var.get())] = value;
+    const auto v = static_cast<std::int8_t>(value);
+    literalValues[pos(var).get()] = v;
+    literalValues[neg(var).get()] = static_cast<std::int8_t>(-v);
 }
 
 
-Solver::Solver(unsigned numVariables) : assignments(numVariables) {}
+Solver::Solver(unsigned numVariables)
+    : assignments(numVariables), watchLists(2 * std::size_t(numVariables)),
+      binaryImplications(2 * std::size_t(numVariables)), seen(numVariables, 0),
+      levelStamps(std::size_t(numVariables) + 1, 0),
+      probeParents(numVariables, 0),
+      branchingHeuristic(VSIDS(numVariables)), phases(numVariables) {}
 
-bool Solver::addClause(Clause clause) {
-    if (clause.isEmpty()) {
+bool Solver::addClause(const Clause &clause) {
+    assert(decisionLevel() == 0);
+    std::vector<Literal> literals(clause.begin(), clause.end());
+    if (!normalize(literals)) {
+        return true;
+    }
+
+    if (literals.empty()) {
         return false;
-    } else if (clause.size() == 1) {
-        if (!assign(clause[0])) {
+    } else if (literals.size() == 1) {
+        return assign(literals[0]);
+    } else if (inputClauses && !inputClauses->insertSorted(literals)) {
+        // normalize already sorted the literals
+        profiler.count("duplicate clauses");
+        return true;
+    } else if (literals.size() == 2) {
+        binaryImplications[literals[0].get()].push_back(literals[1]);
+        binaryImplications[literals[1].get()].push_back(literals[0]);
+    } else {
+        const auto ref = clauses.alloc(literals);
+        attachClause(ref);
+        clauseRefs.push_back(ref);
+    }
+    return true;
+}
+
+bool Solver::normalize(std::vector<Literal> &literals) const {
+    // after sorting, duplicates and complementary literals are neighbours
+    std::ranges::sort(literals, {}, [](Literal l) { return l.get(); });
+    std::size_t j = 0;
+    for (auto l : literals) {
+        if (satisfied(l) || (j > 0 && literals[j - 1] == l.negate())) {
+            // satisfied or tautology
             return false;
         }
-    } else {
-        watchLists[clause.getWatcherByRank(0).get()].push_back(clauses.size());
-        watchLists[clause.getWatcherByRank(1).get()].push_back(clauses.size());
-        clauses.push_back(clause);
+
+        if (!falsified(l) && (j == 0 || literals[j - 1] != l)) {
+            literals[j++] = l;
+        }
     }
+
+    literals.erase(literals.begin() + static_cast<std::ptrdiff_t>(j),
+                   literals.end());
     return true;
 }
 
+auto Solver::getClauseRefs() const -> const std::vector<ClauseRef> & {
+    return clauseRefs;
+}
+
+auto Solver::getLearntClauseRefs() const -> const std::vector<ClauseRef> & {
+    return learntClauses;
+}
+
+auto Solver::getBinaryImplications(Literal l) const
+    -> const std::vector<Literal> & {
+    return binaryImplications[l.get()];
+}
+
+ConstClauseView Solver::getClause(ClauseRef ref) const { return clauses[ref]; }
+
+void Solver::removeClause(ClauseRef ref) {
+    // the literal implied by a clause is at position 0
+    const auto c = clauses[ref];
+    const auto x = var(c[0]).get();
+    if (satisfied(c[0]) && assignments.reasons[x] == Reason::clause(ref)) {
+        assert(assignments.levels[x] == 0);
+        assignments.reasons[x] = {};
+    }
+
+    detachClause(ref);
+    clauses.free(ref);
+    pendingRemovals = true;
+}
+
+std::size_t Solver::removeSatisfiedClauses() {
+    assert(decisionLevel() == 0);
+    std::size_t numRemoved = 0;
+    for (auto ref : clauseRefs) {
+        const auto c = clauses[ref];
+        if (!c.isDeleted() && std::ranges::any_of(c, [this](Literal l) {
+                return satisfied(l);
+            })) {
+            removeClause(ref);
+            ++numRemoved;
+        }
+    }
+
+    // every binary clause is contained in two lists
+    std::size_t numBinaryOccurrences = 0;
+    for (unsigned id = 0; id < binaryImplications.size(); ++id) {
+        auto &implications = binaryImplications[id];
+        if (satisfied(Literal(id))) {
+            numBinaryOccurrences += implications.size();
+            implications.clear();
+        } else {
+            numBinaryOccurrences += std::erase_if(
+                implications, [this](Literal l) { return satisfied(l); });
+        }
+    }
+
+    return numRemoved + numBinaryOccurrences / 2;
+}
+
+bool Solver::subsume() {
+    assert(decisionLevel() == 0);
+    ScopeWatch watch(profiler, "subsumption");
+    if (!unitPropagate()) {
+        return false;
+    }
+
+    removeSatisfiedClauses();
+    Subsumer subsumer(assignments.assignments.size());
+    // clauses of the arena, indexed like the clauses of the subsumer
+    std::vector<ClauseRef> refs;
+    std::vector<Literal> literals;
+    const auto add = [&](ClauseRef ref, bool subsuming) {
+        literals.clear();
+        for (auto l : clauses[ref]) {
+            if (!falsified(l)) {
+                literals.push_back(l);
+            }
+        }
+
+        subsumer.add(literals, subsuming);
+        refs.push_back(ref);
+    };
+
+    for (auto ref : clauseRefs) {
+        if (!clauses[ref].isDeleted()) {
+            add(ref, true);
+        }
+    }
+
+    for (auto ref : learntClauses) {
+        if (!clauses[ref].isDeleted()) {
+            add(ref, false);
+        }
+    }
+
+    for (unsigned id = 0; id < binaryImplications.size(); ++id) {
+        for (auto other : binaryImplications[id]) {
+            if (other.get() > id) {
+                subsumer.add(std::array{Literal(id), other});
+            }
+        }
+    }
+
+    subsumer.run();
+    for (std::uint32_t k = 0; k < refs.size(); ++k) {
+        const auto ref = refs[k];
+        const auto status = subsumer.getStatus(k);
+        if (status == Subsumer::Status::Subsumed) {
+            removeClause(ref);
+        } else if (status == Subsumer::Status::Strengthened) {
+            const auto strengthened = subsumer.getLiterals(k);
+            if (strengthened.size() <= 2) {
+                removeClause(ref);
+                if (strengthened.size() == 1) {
+                    if (!assign(strengthened[0])) {
+                        return false;
+                    }
+
+                    continue;
+                }
+
+                binaryImplications[strengthened[0].get()].push_back(
+                    strengthened[1]);
+                binaryImplications[strengthened[1].get()].push_back(
+                    strengthened[0]);
+                continue;
+            }
+
+            detachClause(ref);
+            for (auto l : strengthened) {
+                seen[var(l).get()] = 1;
+            }
+
+            // removeLiteral moves the last literal, which was already checked
+            for (auto i = clauses[ref].size(); i-- > 0;) {
+                if (!seen[var(clauses[ref][i]).get()]) {
+                    clauses.removeLiteral(ref, i);
+                }
+            }
+
+            for (auto l : strengthened) {
+                seen[var(l).get()] = 0;
+            }
+
+            attachClause(ref);
+        }
+    }
+
+    // binary clauses can only be strengthened to units
+    for (auto k = static_cast<std::uint32_t>(refs.size());
+         k < subsumer.size(); ++k) {
+        if (subsumer.getStatus(k) == Subsumer::Status::Strengthened &&
+            !assign(subsumer.getLiterals(k)[0])) {
+            return false;
+        }
+    }
+
+    profiler.count("subsumed clauses", subsumer.getNumSubsumed());
+    profiler.count("subsumption strengthened clauses",
+                   subsumer.getNumStrengthened());
+    return unitPropagate();
+}
+
+bool Solver::probe() {
+    assert(decisionLevel() == 0);
+    ScopeWatch watch(profiler, "probing");
+    if (!unitPropagate()) {
+        return false;
+    }
+
+    const auto savedPhases = phases.getSaved();
+    const auto restorePhases = [&](bool result) {
+        phases.getSaved() = savedPhases;
+        return result;
+    };
+
+    const auto start = stats.propagations;
+    std::size_t numProbes = 0;
+    std::size_t numFailed = 0;
+    std::size_t numNecessary = 0;
+    // indexed by literal id, literals implied by the first probe of a variable
+    std::vector<char> marks(binaryImplications.size(), 0);
+    std::vector<Literal> implied;
+    std::vector<Literal> impliedByNegation;
+    for (unsigned id = 0; id < binaryImplications.size() &&
+                          stats.propagations - start < ProbingBudget;
+         ++id) {
+        const Literal p(id);
+        if (val(var(p)) != TruthValue::Undefined ||
+            !binaryImplications[id].empty() ||
+            binaryImplications[p.negate().get()].empty()) {
+            continue;
+        }
+
+        ++numProbes;
+        if (!probeLiteral(p, implied)) {
+            ++numFailed;
+            if (!assign(p.negate()) || !unitPropagate()) {
+                return restorePhases(false);
+            }
+
+            continue;
+        }
+
+        ++numProbes;
+        if (!probeLiteral(p.negate(), impliedByNegation)) {
+            ++numFailed;
+            if (!assign(p) || !unitPropagate()) {
+                return restorePhases(false);
+            }
+
+            continue;
+        }
+
+        for (auto l : implied) {
+            marks[l.get()] = 1;
+        }
+
+        for (auto l : impliedByNegation) {
+            if (marks[l.get()]) {
+                ++numNecessary;
+                ASSERT_RESULT(assign(l));
+            }
+        }
+
+        for (auto l : implied) {
+            marks[l.get()] = 0;
+        }
+
+        if (!unitPropagate()) {
+            return restorePhases(false);
+        }
+    }
+
+    profiler.count("probes", numProbes);
+    profiler.count("failed literals", numFailed);
+    profiler.count("necessary assignments", numNecessary);
+    return restorePhases(true);
+}
+
+bool Solver::probeLiteral(Literal l, std::vector<Literal> &implied) {
+    decide(l);
+    const bool ok = unitPropagate();
+    const auto first = static_cast<std::ptrdiff_t>(trailLimits[0]) + 1;
+    implied.assign(trail.begin() + first, trail.end());
+    // (dominator, literal) pairs of the hyper-binary resolvents
+    std::vector<std::pair<Literal, Literal>> resolvents;
+    if (ok) {
+        const auto position = [this](Literal u) {
+            return assignments.trailPositions[var(u).get()];
+        };
+
+        const auto parent = [this](Literal u) {
+            return probeParents[var(u).get()];
+        };
+
+        probeParents[var(l).get()] = l;
+        for (auto q : implied) {
+            const auto r = reason(var(q));
+            if (r.getKind() == Reason::Kind::Binary) {
+                probeParents[var(q).get()] = r.getLiteral().negate();
+                continue;
+            }
+
+            // The other literals of the reason are falsified by the
+            // propagation of l. Their negations form a tree rooted at l in
+            // which each literal is implied by its parent through a binary
+            // clause (or a resolvent added before). Their closest common
+            // ancestor (dominator) implies all of them and thereby q
+            std::optional<Literal> dominator;
+            const auto c = clauses[r.getClause()];
+            for (std::size_t k = 1; k < c.size(); ++k) {
+                auto u = c[k].negate();
+                if (level(var(u)) == 0) {
+                    continue;
+                }
+
+                if (!dominator) {
+                    dominator = u;
+                    continue;
+                }
+
+                // ancestors are placed below their descendants on the trail
+                while (u != *dominator) {
+                    if (position(u) > position(*dominator)) {
+                        u = parent(u);
+                    } else {
+                        dominator = parent(*dominator);
+                    }
+                }
+            }
+
+            assert(dominator);
+            probeParents[var(q).get()] = *dominator;
+            resolvents.emplace_back(*dominator, q);
+        }
+    }
+
+    // the heuristic is not notified about probes
+    undoAssignments(0);
+    for (auto [dominator, q] : resolvents) {
+        binaryImplications[dominator.negate().get()].push_back(q);
+        binaryImplications[q.get()].push_back(dominator.negate());
+    }
+
+    profiler.count("hyper-binary resolvents", resolvents.size());
+    return ok;
+}
+
+bool Solver::substituteEquivalences() {
+    assert(decisionLevel() == 0);
+    ScopeWatch watch(profiler, "equivalent literal substitution");
+    if (!unitPropagate()) {
+        return false;
+    }
+
+    removeSatisfiedClauses();
+    const auto representatives = findEquivalences(binaryImplications);
+    if (!representatives) {
+        return false;
+    }
+
+    const auto &repr = *representatives;
+    std::size_t numSubstituted = 0;
+    for (unsigned x = 0; x < assignments.assignments.size(); ++x) {
+        const auto r = repr[pos(x).get()];
+        if (r != pos(x)) {
+            // x is replaced by r, the reconstruction restores x = r
+            reconstruction.push(pos(x), std::array{pos(x), r.negate()});
+            reconstruction.push(neg(x), std::array{neg(x), r});
+            ++numSubstituted;
+        }
+    }
+
+    if (numSubstituted == 0) {
+        return true;
+    }
+
+    std::vector<Literal> literals;
+    // stores the substituted clause, false if it is empty
+    const auto store = [&](bool learnt, unsigned lbd, float activity,
+                           std::vector<ClauseRef> &refs) {
+        if (!normalize(literals)) {
+            return true;
+        }
+
+        if (literals.size() <= 1) {
+            return !literals.empty() && assign(literals[0]);
+        }
+
+        if (literals.size() == 2) {
+            binaryImplications[literals[0].get()].push_back(literals[1]);
+            binaryImplications[literals[1].get()].push_back(literals[0]);
+            return true;
+        }
+
+        const auto ref = clauses.alloc(literals, learnt);
+        if (learnt) {
+            auto c = clauses[ref];
+            c.setLbd(std::min<unsigned>(lbd, literals.size()));
+            c.setActivity(activity);
+        }
+
+        attachClause(ref);
+        refs.push_back(ref);
+        return true;
+    };
+
+    for (auto *refs : {&clauseRefs, &learntClauses}) {
+        // substituted clauses are appended to the list
+        const auto numRefs = refs->size();
+        for (std::size_t k = 0; k < numRefs; ++k) {
+            const auto ref = (*refs)[k];
+            const auto c = clauses[ref];
+            if (c.isDeleted() || std::ranges::none_of(c, [&repr](Literal l) {
+                    return repr[l.get()] != l;
+                })) {
+                continue;
+            }
+
+            literals.clear();
+            for (auto l : c) {
+                literals.push_back(repr[l.get()]);
+            }
+
+            const bool learnt = c.isLearnt();
+            const auto lbd = learnt ? c.getLbd() : 0;
+            const auto activity = learnt ? c.getActivity() : 0.f;
+            removeClause(ref);
+            if (!store(learnt, lbd, activity, *refs)) {
+                return false;
+            }
+        }
+    }
+
+    // binary clauses are rebuilt, the clauses that define the equivalences
+    // become tautologies
+    std::vector<std::pair<Literal, Literal>> binaries;
+    for (unsigned id = 0; id < binaryImplications.size(); ++id) {
+        for (auto other : binaryImplications[id]) {
+            if (other.get() > id) {
+                binaries.emplace_back(Literal(id), other);
+            }
+        }
+
+        binaryImplications[id].clear();
+    }
+
+    for (auto [a, b] : binaries) {
+        literals = {repr[a.get()], repr[b.get()]};
+        if (!store(false, 0, 0, clauseRefs)) {
+            return false;
+        }
+    }
+
+    for (auto &implications : binaryImplications) {
+        std::ranges::sort(implications, {}, [](Literal l) { return l.get(); });
+        const auto [first, last] = std::ranges::unique(implications);
+        implications.erase(first, last);
+    }
+
+    profiler.count("substituted variables", numSubstituted);
+    return unitPropagate();
+}
+
+void Solver::attachClause(ClauseRef ref) {
+    const auto c = clauses[ref];
+    watchLists[c[0].get()].push_back({ref, c[1]});
+    watchLists[c[1].get()].push_back({ref, c[0]});
+}
+
+void Solver::detachClause(ClauseRef ref) {
+    const auto c = clauses[ref];
+    for (auto l : {c[0], c[1]}) {
+        std::erase_if(watchLists[l.get()],
+                      [ref](const Watcher &w) { return w.clause == ref; });
+    }
+}
+
+void Solver::purgeRemovedClauses() {
+    const auto removed = [this](ClauseRef ref) {
+        return clauses[ref].isDeleted();
+    };
+    std::erase_if(clauseRefs, removed);
+    std::erase_if(learntClauses, removed);
+    pendingRemovals = false;
+}
+
+void Solver::collectGarbage() {
+    ScopeWatch watch(profiler, "garbage collection");
+    if (pendingRemovals) {
+        purgeRemovedClauses();
+    }
+
+    ClauseArena to;
+    to.reserve(clauses.size() - clauses.wasted());
+    // clause list first, so that clauses keep their relative order
+    for (auto &ref : clauseRefs) {
+        ref = clauses.relocate(ref, to);
+    }
+
+    for (auto &ref : learntClauses) {
+        ref = clauses.relocate(ref, to);
+    }
+
+    for (auto &watchList : watchLists) {
+        std::erase_if(watchList, [this](const Watcher &w) {
+            return clauses[w.clause].isDeleted();
+        });
+        for (auto &w : watchList) {
+            w.clause = clauses.relocate(w.clause, to);
+        }
+    }
+
+    for (auto l : trail) {
+        auto &reason = assignments.reasons[var(l).get()];
+        if (reason.getKind() == Reason::Kind::Clause) {
+            reason = Reason::clause(clauses.relocate(reason.getClause(), to));
+        }
+    }
+
+    profiler.count("garbage collections");
+    profiler.count("garbage collection bytes reclaimed",
+                   (clauses.size() - to.size()) * sizeof(std::uint32_t));
+    clauses = std::move(to);
+}
+
+const Profiler &Solver::getProfiler() const { return profiler; }
+
+void Solver::setHeuristic(AnyHeuristic h) {
+    branchingHeuristic = std::move(h);
+}
+
+void Solver::setRestartPolicy(AnyRestartPolicy policy) {
+    restartPolicy = std::move(policy);
+}
+
+void Solver::setChronologicalBacktracking(unsigned threshold) {
+    chronoThreshold = threshold;
+}
+
+void Solver::setClauseDeduplication(bool enabled) {
+    if (enabled) {
+        inputClauses.emplace();
+    } else {
+        inputClauses.reset();
+    }
+}
+
+void Solver::setModeSwitching(bool enabled) {
+    if (enabled) {
+        modeController.emplace(assignments.assignments.size());
+    } else {
+        modeController.reset();
+    }
+}
+
 TruthValue Solver::val(Variable x) const { return assignments[x]; }
 
 bool Solver::satisfied(Literal l) const {
-    return l.sign() == (short)assignments[var(l)];
+    return assignments.literalValues[l.get()] > 0;
 }
 
 bool Solver::falsified(Literal l) const {
-    return -1 * l.sign() == (short)assignments[var(l)];
+    return assignments.literalValues[l.get()] < 0;
 }
 
-bool Solver::assign(Literal l) {
+bool Solver::assign(Literal l, Reason reason) {
     if (falsified(l)) {
         return false;
     }
-    unitLiterals.push_back(l);
-    assignments.set(var(l), (TruthValue)l.sign());
+
+    if (satisfied(l)) {
+        return true;
+    }
+
+    const auto x = var(l).get();
+    assignments.set(x, static_cast<TruthValue>(l.sign()));
+    assignments.levels[x] = chronoThreshold == NoChronologicalBacktracking
+                                ? decisionLevel()
+                                : assignmentLevel(reason);
+    assignments.reasons[x] = reason;
+    assignments.trailPositions[x] = static_cast<unsigned>(trail.size());
+    trail.push_back(l);
     return true;
 }
 
-bool Solver::unitPropagate() {
-    size_t i = 0;
-    while (i < unitLiterals.size()) {
-        auto l = unitLiterals[i].negate();
-        if (!unitPropagate(l)) {
-            return false;
+void Solver::decide(Literal l) {
+    assert(val(var(l)) == TruthValue::Undefined);
+    trailLimits.push_back(trail.size());
+    ASSERT_RESULT(assign(l));
+}
+
+unsigned Solver::decisionLevel() const {
+    return static_cast<unsigned>(trailLimits.size());
+}
+
+unsigned Solver::level(Variable x) const { return assignments.levels[x.get()]; }
+
+Reason Solver::reason(Variable x) const { return assignments.reasons[x.get()]; }
+
+void Solver::backtrack(unsigned level) {
+    if (modeController) {
+        backtrack(level, *modeController);
+        return;
+    }
+
+    std::visit([this, level](auto &h) { backtrack(level, h); },
+               branchingHeuristic);
+}
+
+void Solver::undoAssignments(unsigned level) {
+    if (decisionLevel() <= level) {
+        return;
+    }
+
+    // Literals of lower levels are moved down in trail order. They are
+    // propagated again, since the clauses they were watched in may have been
+    // satisfied by literals that are now unassigned
+    const auto limit = trailLimits[level];
+    auto j = limit;
+    auto notified = limit;
+    for (auto i = limit; i < trail.size(); ++i) {
+        const auto l = trail[i];
+        const auto x = var(l).get();
+        if (assignments.levels[x] <= level) {
+            notified += i < numNotified;
+            assignments.trailPositions[x] = static_cast<unsigned>(j);
+            trail[j++] = l;
+        } else {
+            phases.save(l);
+            assignments.set(x, TruthValue::Undefined);
         }
-        i++;
     }
-    return true;
+
+    trail.erase(trail.begin() + static_cast<std::ptrdiff_t>(j), trail.end());
+    trailLimits.resize(level);
+    qhead = std::min(qhead, limit);
+    numNotified = std::min(numNotified, notified);
 }
 
-bool Solver::unitPropagate(Literal l) {
-    size_t watchListIndex = 0;
-    while (watchListIndex < watchLists[l.get()].size()) {
-
-        auto clauseIndex = watchLists[l.get()][watchListIndex];
-        auto &c = clauses[clauseIndex];
-
-        // std::cout << "Clause and literal: " << c << "  " << l << "\n";
-        // std::cout << c.getWatcherByRank(0) << c.getWatcherByRank(1) << "\n";
-        // std::cout << "Watchlist: " << watchLists[l.get()] << "\n";
-        // std::cout << "Clauses: " << clauses << "\n";
-        // std::cout << "\n";
-
-        auto rank = c.getRank(l);
-        assert(rank != -1);
-        auto start = c.getIndex(rank);
-        auto i = start;
-        auto p = c.getWatcherByRank(1 - rank);
-        if (!satisfied(p)) {
-            while (true) {
-                i++;
-                if (i == c.size()) {
-                    i = 0;
-                }
-                if (i == start) {
-                    break;
-                }
-                auto ci = c[i];
-                if (ci != p && !falsified(ci)) {
-                    auto old_lit = set_watcher(clauseIndex, ci, rank);
-                    if (old_lit == l) {
-                        watchListIndex--;
-                    }
-                    break;
-                }
+unsigned Solver::assignmentLevel(Reason reason) const {
+    switch (reason.getKind()) {
+    case Reason::Kind::Binary:
+        return level(var(reason.getLiteral()));
+    case Reason::Kind::Clause: {
+        const auto c = clauses[reason.getClause()];
+        unsigned result = 0;
+        for (std::size_t k = 1; k < c.size(); ++k) {
+            result = std::max(result, level(var(c[k])));
+        }
+
+        return result;
+    }
+    default:
+        return decisionLevel();
+    }
+}
+
+unsigned Solver::conflictLevel() const {
+    if (conflict.getKind() == Reason::Kind::Binary) {
+        return std::max(level(var(conflict.getLiteral())),
+                        level(var(conflictLiteral)));
+    }
+
+    unsigned result = 0;
+    for (auto l : clauses[conflict.getClause()]) {
+        result = std::max(result, level(var(l)));
+    }
+
+    return result;
+}
+
+template<heuristic H> void Solver::notifyAssignments(H &h) {
+    for (; numNotified < trail.size(); ++numNotified) {
+        hooks::assign(h, var(trail[numNotified]));
+    }
+}
+
+template<heuristic H> void Solver::backtrack(unsigned level, H &h) {
+    if (decisionLevel() <= level) {
+        return;
+    }
+
+    for (auto i = numNotified; i > trailLimits[level]; --i) {
+        if (this->level(var(trail[i - 1])) > level) {
+            hooks::unassign(h, var(trail[i - 1]));
+        }
+    }
+
+    undoAssignments(level);
+}
+
+template<heuristic H> void Solver::restart(unsigned n, H &h) {
+    // may switch the mode of a ModeController, the kept levels are then
+    // computed with the heuristic of the new mode
+    withRestartPolicy(h, [](auto &policy) { policy.onRestart(); });
+    unsigned level = 0;
+    if constexpr (requires(const H &c, Variable x) { c.score(x); }) {
+        // levels whose decisions are preferred to the next decision would be
+        // redone in the same way
+        const auto next = h(assignments.assignments, n - trail.size());
+        const auto nextScore = h.score(next);
+        while (level < decisionLevel() &&
+               h.score(var(trail[trailLimits[level]])) > nextScore) {
+            ++level;
+        }
+    }
+
+    backtrack(level, h);
+    ++stats.restarts;
+    stats.reusedLevels += level;
+    stats.maxRestartInterval = std::max(stats.maxRestartInterval,
+                                        stats.conflicts - stats.lastRestart);
+    stats.lastRestart = stats.conflicts;
+}
+
+template<heuristic H, typename F>
+decltype(auto) Solver::withRestartPolicy(H &h, F &&f) {
+    if constexpr (restart_policy<H>) {
+        return f(h);
+    } else {
+        return std::visit(std::forward<F>(f), restartPolicy);
+    }
+}
+
+template<heuristic H> void Solver::rephase(H &h) {
+    backtrack(0, h);
+    const auto method = phases.nextRephase();
+    if (method == Phases::Rephase::Walk) {
+        walk(unsatisfiedClauses(), phases.getSaved(), WalkFlips,
+             phases.getNumRephases());
+        ++stats.walks;
+    }
+
+    phases.rephase(method);
+}
+
+auto Solver::unsatisfiedClauses() const -> std::vector<std::vector<Literal>> {
+    assert(decisionLevel() == 0);
+    std::vector<std::vector<Literal>> result;
+    const auto add = [&](auto &&literals) {
+        std::vector<Literal> c;
+        for (Literal l : literals) {
+            if (satisfied(l)) {
+                return;
             }
-            if (i == start) {
-                if (!assign(p)) {
-                    return false;
-                }
+
+            if (!falsified(l)) {
+                c.emplace_back(l);
             }
         }
-        watchListIndex++;
+
+        result.emplace_back(std::move(c));
+    };
+
+    for (auto ref : clauseRefs) {
+        if (!clauses[ref].isDeleted()) {
+            add(clauses[ref]);
+        }
     }
+
+    for (unsigned id = 0; id < binaryImplications.size(); ++id) {
+        for (auto other : binaryImplications[id]) {
+            if (other.get() > id) {
+                add(std::array{Literal(id), other});
+            }
+        }
+    }
+
+    return result;
+}
+
+bool Solver::unitPropagate() {
+    if (clauses.wasted() > GarbageFraction * clauses.size()) {
+        collectGarbage();
+    }
+
+    while (qhead < trail.size()) {
+        const auto l = trail[qhead++];
+        ++stats.propagations;
+        if (!unitPropagate(l.negate())) {
+            return false;
+        }
+    }
+
     return true;
 }
 
-Literal Solver::set_watcher(size_t clause_index, Literal l, short rank) {
-    assert(rank == 0 || rank == 1);
+bool Solver::unitPropagate(Literal l) {
+    for (auto implied : binaryImplications[l.get()]) {
+        if (!assign(implied, Reason::binary(l))) {
+            conflict = Reason::binary(l);
+            conflictLiteral = implied;
+            return false;
+        }
+    }
+
+    // The watch list is compacted in place: i is the next watcher to visit, j
+    // the next free slot. Watchers that move to another literal are simply not
+    // copied back.
+    auto &watchList = watchLists[l.get()];
+    auto i = watchList.begin();
+    auto j = i;
+    const auto end = watchList.end();
+    bool ok = true;
+    while (i != end) {
+        const auto w = *i++;
+        // satisfied clauses are skipped without touching the clause memory
+        if (satisfied(w.blocker)) {
+            *j++ = w;
+            continue;
+        }
+
+        auto c = clauses[w.clause];
+        // the falsified watcher is moved to position 1
+        if (c[0] == l) {
+            c.swap(0, 1);
+        }
 
-    auto &c = clauses[clause_index];
-    auto old_literal = c.getWatcherByRank(rank);
-    auto &watchList = watchLists[old_literal.get()];
+        assert(c[1] == l);
+        const auto p = c[0];
+        if (p != w.blocker && satisfied(p)) {
+            *j++ = {w.clause, p};
+            continue;
+        }
 
-    watchList.erase(
-        std::remove(watchList.begin(), watchList.end(), clause_index),
-        watchList.end());
+        // Search for a replacement watcher. The search resumes where the last
+        // one stopped and wraps around, so falsified prefixes of long clauses
+        // are not scanned over and over again.
+        const auto size = c.size();
+        const auto start = c.getSearchPos();
+        const auto *literals = c.literals();
+        const auto *values = assignments.literalValues.data();
+        auto k =
+            start + findNonFalsified(literals + start, size - start, values);
+        if (k == size) {
+            k = 2 + findNonFalsified(literals + 2, start - 2, values);
+            if (k == start) {
+                k = size;
+            }
+        }
 
-    watchLists[l.get()].push_back(clause_index);
+        if (k < size) {
+            c.setSearchPos(k);
+            c.swap(1, k);
+            watchLists[c[1].get()].push_back({w.clause, p});
+            continue;
+        }
 
-    assert(c.setWatcher(l, rank));
+        *j++ = {w.clause, p};
+        if (!assign(p, Reason::clause(w.clause))) {
+            conflict = Reason::clause(w.clause);
+            // keep the unvisited tail of the watch list
+            j = std::copy(i, end, j);
+            ok = false;
+            break;
+        }
+    }
 
-    return old_literal;
+    watchList.erase(j, watchList.end());
+    return ok;
 }
 
 /**
- * Here you have a possible implementation of the rebase-method. It should work
- * out of the box. To use it, remove the throw-expression and un-comment the
- * code below. The implementation requires that your solver has some sort of
- * container of pointer types to clause called 'clauses' (e.g.
- * std::vector<ClausePointer>). Additionally, your solver needs to have a
- * container of unit literals called 'unitLiterals'.
+ * Collects the non-deleted clauses without their falsified literals, skipping
+ * satisfied clauses. Duplicates among the reduced clauses are filtered by a
+ * ClauseSet, so the clauses are deduplicated in expected linear time in the
+ * total number of literals independent of their literal order.
  */
 auto Solver::rebase() const -> std::vector<Clause> {
     std::vector<Clause> reducedClauses;
+    // Reduced clauses that were already added, compared independent of the
+    // order of their literals
+    ClauseSet keptClauses;
+    keptClauses.reserve(clauseRefs.size());
     // We check all clauses in the solver. If the clause is SAT (at least one
     // literal is satisfied), we don't include it. Additionally, we remove all
     // falsified literals from the clauses since we only care about unassigned
     // literals.
-    for (const auto &c : clauses) {
+    for (auto ref : clauseRefs) {
+        const auto c = clauses[ref];
+        if (c.isDeleted()) {
+            continue;
+        }
+
         bool sat = false;
         // We're creating a new (possibly smaller clause from the current clause
         std::vector<Literal> newLits;
@@ -181,23 +992,42 @@ auto Solver::rebase() const -> std::vector<Clause> {
         }
 
         if (!sat) {
-            // create the new clause (move all the literals inside the
-            // Clause-class)
-            Clause newClause(std::move(newLits));
-            // Check if we already added an equivalent clause
-            auto res = std::ranges::find_if(
-                reducedClauses, [&newClause](const auto &clause) {
-                    return clause.sameLiterals(newClause);
-                });
-            if (res == reducedClauses.end()) {
-                // The new clause is not yet contained => add it
-                reducedClauses.emplace_back(std::move(newClause));
+            // Check if we already added an equivalent clause. If not, create
+            // the new clause (move all the literals inside the Clause-class)
+            if (keptClauses.insert(newLits)) {
+                reducedClauses.emplace_back(std::move(newLits));
+            }
+        }
+    }
+
+    // Binary clauses are stored twice as implications, we only consider the
+    // occurrence at the smaller literal
+    for (unsigned id = 0; id < binaryImplications.size(); ++id) {
+        const Literal l(id);
+        if (satisfied(l)) {
+            continue;
+        }
+
+        for (auto other : binaryImplications[id]) {
+            if (other.get() < id || satisfied(other)) {
+                continue;
+            }
+
+            std::vector<Literal> newLits;
+            for (auto lit : {l, other}) {
+                if (!falsified(lit)) {
+                    newLits.emplace_back(lit);
+                }
+            }
+
+            if (keptClauses.insert(newLits)) {
+                reducedClauses.emplace_back(std::move(newLits));
             }
         }
     }
 
     // Finally, we need to add all the unit literals as well
-    for (Literal l : unitLiterals) {
+    for (Literal l : trail) {
         reducedClauses.emplace_back(std::vector{l});
     }
 
@@ -205,28 +1035,529 @@ auto Solver::rebase() const -> std::vector<Clause> {
 }
 
 bool Solver::dpll(unsigned n) {
+    return std::visit([this, n](auto &h) { return dpllSearch(n, h); },
+                      branchingHeuristic);
+}
+
+template<heuristic H> bool Solver::dpllSearch(unsigned n, H &h) {
+    if (!unitPropagate()) {
+        return false;
+    }
+
+    removeSatisfiedClauses();
     while (true) {
-        if (unitPropagate()) {
-            if (unitLiterals.size() == n) {
+        const bool ok = unitPropagate();
+        notifyAssignments(h);
+        if (ok) {
+            if (trail.size() == n) {
                 return true;
             }
-            trail.push_back(unitLiterals.size());
-            assign(pos(FirstVariable()(assignments.assignments, assignments.assignments.size())));
+
+            decide(phases.decide(h(assignments.assignments, n - trail.size()),
+                                 false));
         } else {
-            if (trail.size() == 0) {
+            if (decisionLevel() == 0) {
                 return false;
             }
-            auto d = unitLiterals[trail.back()];
-            while (unitLiterals.size() > trail.back()) {
-                auto l = unitLiterals.back();
-                assignments.set(var(l), TruthValue::Undefined);
-                unitLiterals.pop_back();
+
+            // flip the last decision, the flipped literal is implied on the
+            // level below and is undone when backtracking further
+            const auto d = trail[trailLimits.back()];
+            backtrack(decisionLevel() - 1, h);
+            ASSERT_RESULT(assign(d.negate()));
+        }
+    }
+}
+
+namespace {
+/**
+ * Abstraction of a decision level to one bit of a 32 bit set
+ */
+std::uint32_t abstractLevel(unsigned level) { return 1u << (level & 31); }
+} // namespace
+
+template<heuristic H>
+unsigned Solver::analyzeConflict(std::vector<Literal> &learnt, H &h) {
+    learnt.clear();
+    strengthenable.clear();
+    // placeholder for the asserting literal
+    learnt.emplace_back(0);
+    unsigned pathCount = 0;
+    const auto visit = [&](Literal q) {
+        const auto x = var(q).get();
+        if (!seen[x] && assignments.levels[x] > 0) {
+            seen[x] = 1;
+            hooks::bump(h, x);
+            if (assignments.levels[x] >= decisionLevel()) {
+                ++pathCount;
+            } else {
+                learnt.emplace_back(q);
+            }
+        }
+    };
+
+    // Resolve the conflict clause with the reasons of the literals of the
+    // current decision level in reverse trail order until only one of them
+    // (the first UIP) is left
+    Reason current = conflict;
+    std::optional<Literal> p;
+    auto index = trail.size();
+    while (true) {
+        if (current.getKind() == Reason::Kind::Clause) {
+            auto c = clauses[current.getClause()];
+            assert(!p || c[0] == *p);
+            if (c.isLearnt()) {
+                bumpClauseActivity(c);
+                c.setUsed(true);
+                if (c.getLbd() > CoreLbd) {
+                    c.setLbd(std::min(c.getLbd(), computeLbd(c)));
+                }
+            }
+
+            bool hasRootLiteral = false;
+            for (std::size_t k = p ? 1 : 0; k < c.size(); ++k) {
+                hasRootLiteral |= level(var(c[k])) == 0;
+                visit(c[k]);
+            }
+
+            // The resolvent contains all literals of the antecedent except for
+            // the pivot and literals of level 0. If it is not larger, it
+            // subsumes the antecedent. With at least two literals of the
+            // current level left, the strengthened antecedent is not unit
+            // after backjumping
+            if (p && !hasRootLiteral && pathCount >= 2 &&
+                learnt.size() - 1 + pathCount == c.size() - 1) {
+                strengthenable.emplace_back(current.getClause(), *p);
+            }
+        } else {
+            assert(current.getKind() == Reason::Kind::Binary);
+            visit(current.getLiteral());
+            if (!p) {
+                visit(conflictLiteral);
+            }
+        }
+
+        // with chronological backtracking, seen literals of lower levels can
+        // be placed above literals of the current level
+        do {
+            p = trail[--index];
+        } while (!seen[var(*p).get()] ||
+                 level(var(*p)) < decisionLevel());
+
+        seen[var(*p).get()] = 0;
+        if (--pathCount == 0) {
+            break;
+        }
+
+        current = reason(var(*p));
+    }
+
+    learnt[0] = p->negate();
+
+    // Recursive minimization: remove all literals that are implied by the
+    // other literals of the learned clause
+    analyzeToClear.assign(learnt.begin() + 1, learnt.end());
+    std::uint32_t abstractLevels = 0;
+    for (std::size_t k = 1; k < learnt.size(); ++k) {
+        abstractLevels |= abstractLevel(level(var(learnt[k])));
+    }
+
+    const auto size = learnt.size();
+    std::size_t j = 1;
+    for (std::size_t k = 1; k < size; ++k) {
+        if (reason(var(learnt[k])).getKind() == Reason::Kind::None ||
+            !isRedundant(learnt[k], abstractLevels)) {
+            learnt[j++] = learnt[k];
+        }
+    }
+
+    learnt.erase(learnt.begin() + static_cast<std::ptrdiff_t>(j), learnt.end());
+    stats.minimizedLiterals += size - j;
+    stats.learntLiterals += j;
+
+    // Variables in the reasons of the learned clause that are not part of it
+    const auto reasonSide = [this, &h](Literal q) {
+        const auto x = var(q).get();
+        if (!seen[x] && assignments.levels[x] > 0) {
+            seen[x] = 1;
+            analyzeToClear.push_back(q);
+            hooks::reasonSide(h, x);
+        }
+    };
+
+    seen[var(learnt[0]).get()] = 1;
+    analyzeToClear.push_back(learnt[0]);
+    for (auto l : learnt) {
+        const auto r = reason(var(l));
+        if (r.getKind() == Reason::Kind::Clause) {
+            const auto c = clauses[r.getClause()];
+            for (std::size_t k = 1; k < c.size(); ++k) {
+                reasonSide(c[k]);
+            }
+        } else if (r.getKind() == Reason::Kind::Binary) {
+            reasonSide(r.getLiteral());
+        }
+    }
+
+    for (auto l : analyzeToClear) {
+        seen[var(l).get()] = 0;
+    }
+
+    unsigned backjumpLevel = 0;
+    for (std::size_t k = 1; k < learnt.size(); ++k) {
+        const auto lvl = level(var(learnt[k]));
+        if (lvl > backjumpLevel) {
+            backjumpLevel = lvl;
+            std::swap(learnt[1], learnt[k]);
+        }
+    }
+
+    return backjumpLevel;
+}
+
+bool Solver::isRedundant(Literal l, std::uint32_t abstractLevels) {
+    // Depth first search over the implication graph. All paths have to end in
+    // literals of the learned clause (marked as seen) or at level 0. A literal
+    // whose level does not occur in the learned clause cannot be implied by it
+    analyzeStack.assign(1, l);
+    const auto top = analyzeToClear.size();
+    const auto check = [&](Literal q) {
+        const auto x = var(q).get();
+        if (seen[x] || assignments.levels[x] == 0) {
+            return true;
+        }
+
+        if (assignments.reasons[x].getKind() == Reason::Kind::None ||
+            !(abstractLevel(assignments.levels[x]) & abstractLevels)) {
+            return false;
+        }
+
+        seen[x] = 1;
+        analyzeStack.push_back(q);
+        analyzeToClear.push_back(q);
+        return true;
+    };
+
+    while (!analyzeStack.empty()) {
+        const auto q = analyzeStack.back();
+        analyzeStack.pop_back();
+        const auto r = reason(var(q));
+        bool ok = true;
+        if (r.getKind() == Reason::Kind::Clause) {
+            const auto c = clauses[r.getClause()];
+            for (std::size_t k = 1; k < c.size() && ok; ++k) {
+                ok = check(c[k]);
+            }
+        } else {
+            assert(r.getKind() == Reason::Kind::Binary);
+            ok = check(r.getLiteral());
+        }
+
+        if (!ok) {
+            // literals marked during this search are not known to be redundant
+            for (auto k = top; k < analyzeToClear.size(); ++k) {
+                seen[var(analyzeToClear[k]).get()] = 0;
+            }
+
+            analyzeToClear.erase(analyzeToClear.begin() +
+                                     static_cast<std::ptrdiff_t>(top),
+                                 analyzeToClear.end());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void Solver::strengthenAntecedents() {
+    for (auto [ref, pivot] : strengthenable) {
+        auto c = clauses[ref];
+        assert(c[0] == pivot && val(var(pivot)) == TruthValue::Undefined);
+        detachClause(ref);
+        clauses.removeLiteral(ref, 0);
+        ++stats.strengthenedClauses;
+        if (c.size() == 2) {
+            binaryImplications[c[0].get()].push_back(c[1]);
+            binaryImplications[c[1].get()].push_back(c[0]);
+            clauses.free(ref);
+            pendingRemovals = true;
+            continue;
+        }
+
+        // move two unassigned literals to the watched positions
+        std::size_t numWatched = 0;
+        for (std::size_t k = 0; k < c.size() && numWatched < 2; ++k) {
+            if (val(var(c[k])) == TruthValue::Undefined) {
+                c.swap(numWatched++, k);
+            }
+        }
+
+        assert(numWatched == 2);
+        attachClause(ref);
+    }
+
+    strengthenable.clear();
+}
+
+template<clause_like C> unsigned Solver::computeLbd(const C &clause) {
+    ++currentStamp;
+    unsigned lbd = 0;
+    for (Literal l : clause) {
+        auto &stamp = levelStamps[level(var(l))];
+        if (stamp != currentStamp) {
+            stamp = currentStamp;
+            ++lbd;
+        }
+    }
+
+    return lbd;
+}
+
+void Solver::bumpClauseActivity(ClauseView c) {
+    const auto activity = c.getActivity() + clauseActivityIncrement;
+    c.setActivity(static_cast<float>(activity));
+    if (activity > 1e20) {
+        for (auto ref : learntClauses) {
+            auto learnt = clauses[ref];
+            learnt.setActivity(learnt.getActivity() * 1e-20f);
+        }
+
+        clauseActivityIncrement *= 1e-20;
+    }
+}
+
+bool Solver::isLocked(ClauseRef ref) const {
+    const auto c = clauses[ref];
+    return satisfied(c[0]) && reason(var(c[0])) == Reason::clause(ref);
+}
+
+void Solver::reduceLearntClauses() {
+    std::vector<ClauseRef> candidates;
+    for (auto ref : learntClauses) {
+        auto c = clauses[ref];
+        if (c.isDeleted() || c.getLbd() <= CoreLbd || isLocked(ref)) {
+            continue;
+        }
+
+        // used tier 2 clauses survive one more round, unused ones fall back to
+        // the local tier. The used flag does not protect local clauses
+        const bool used = c.isUsed();
+        c.setUsed(false);
+        if (used && c.getLbd() <= Tier2Lbd) {
+            continue;
+        }
+
+        candidates.push_back(ref);
+    }
+
+    // worst clauses first: high literal block distance, low activity
+    std::ranges::sort(candidates, [this](ClauseRef a, ClauseRef b) {
+        const auto ca = clauses[a];
+        const auto cb = clauses[b];
+        if (ca.getLbd() != cb.getLbd()) {
+            return ca.getLbd() > cb.getLbd();
+        }
+
+        return ca.getActivity() < cb.getActivity();
+    });
+
+    const auto numDropped = candidates.size() / 2;
+    // the watchers are dropped by the garbage collection in a single pass over
+    // the watch lists instead of detaching every clause separately
+    for (std::size_t k = 0; k < numDropped; ++k) {
+        clauses.free(candidates[k]);
+        pendingRemovals = true;
+    }
+
+    collectGarbage();
+    ++stats.reductions;
+    nextReduction = stats.conflicts + ReductionInterval +
+                    stats.reductions * ReductionIncrement;
+    stats.droppedClauses += numDropped;
+    stats.keptClauses = learntClauses.size();
+}
+
+void Solver::addLearntClause(const std::vector<Literal> &learnt,
+                             unsigned lbd) {
+    if (learnt.size() == 1) {
+        assert(decisionLevel() == 0);
+        ASSERT_RESULT(assign(learnt[0]));
+    } else if (learnt.size() == 2) {
+        binaryImplications[learnt[0].get()].push_back(learnt[1]);
+        binaryImplications[learnt[1].get()].push_back(learnt[0]);
+        ASSERT_RESULT(assign(learnt[0], Reason::binary(learnt[1])));
+    } else {
+        const auto ref = clauses.alloc(learnt, true);
+        auto c = clauses[ref];
+        c.setLbd(lbd);
+        // new tier 2 clauses survive the next reduction
+        c.setUsed(true);
+        bumpClauseActivity(c);
+        attachClause(ref);
+        learntClauses.push_back(ref);
+        ASSERT_RESULT(assign(learnt[0], Reason::clause(ref)));
+    }
+}
+
+bool Solver::cdcl(unsigned n) {
+    if (modeController) {
+        return cdclSearch(n, *modeController);
+    }
+
+    return std::visit([this, n](auto &h) { return cdclSearch(n, h); },
+                      branchingHeuristic);
+}
+
+template<heuristic H> bool Solver::cdclSearch(unsigned n, H &h) {
+    if (!unitPropagate()) {
+        return false;
+    }
+
+    removeSatisfiedClauses();
+    stats = {};
+    nextReduction = ReductionInterval;
+    nextRephase = RephaseInterval;
+    nextSubsumption = SubsumptionInterval;
+    nextProbing = ProbingInterval;
+    if constexpr (requires { h.useTargetPhases(); }) {
+        useTargetPhases = h.useTargetPhases();
+    } else {
+        useTargetPhases = true;
+    }
+
+    std::vector<Literal> learnt;
+    bool result;
+    while (true) {
+        const bool ok = unitPropagate();
+        notifyAssignments(h);
+        if (!ok) {
+            ++stats.conflicts;
+            const auto conflictAt =
+                chronoThreshold == NoChronologicalBacktracking
+                    ? decisionLevel()
+                    : conflictLevel();
+            if (conflictAt == 0) {
+                result = false;
+                break;
+            }
+
+            // analysis requires the conflict level to be the current level
+            backtrack(conflictAt, h);
+            const auto trailSize = trail.size();
+            // the trail below the conflict level is conflict free
+            phases.update(std::span(trail.data(), trailLimits.back()));
+            const auto backjumpLevel = analyzeConflict(learnt, h);
+            hooks::conflict(h);
+            const auto lbd = computeLbd(learnt);
+            const auto distance = decisionLevel() - backjumpLevel;
+            if (learnt.size() > 1 && distance > 1 &&
+                distance > chronoThreshold) {
+                ++stats.chronoBacktracks;
+                backtrack(decisionLevel() - 1, h);
+            } else {
+                backtrack(backjumpLevel, h);
+            }
+
+            strengthenAntecedents();
+            addLearntClause(learnt, lbd);
+            withRestartPolicy(h, [lbd, trailSize](auto &policy) {
+                policy.onConflict(lbd, trailSize);
+            });
+            clauseActivityIncrement /= ClauseActivityDecay;
+            if (stats.conflicts >= nextReduction) {
+                reduceLearntClauses();
+            }
+        } else {
+            if (trail.size() == n) {
+                result = true;
+                break;
+            }
+
+            if (stats.conflicts >= nextSubsumption) {
+                backtrack(0, h);
+                nextSubsumption = stats.conflicts + SubsumptionInterval;
+                if (!subsume()) {
+                    result = false;
+                    break;
+                }
+
+                continue;
+            }
+
+            if (stats.conflicts >= nextProbing) {
+                backtrack(0, h);
+                nextProbing = stats.conflicts + ProbingInterval;
+                if (!probe() || !substituteEquivalences()) {
+                    result = false;
+                    break;
+                }
+
+                continue;
             }
-            auto toPropagate = trail.back();
-            trail.pop_back();
-            assert(assign(d.negate()));
+
+            if (stats.conflicts >= nextRephase) {
+                rephase(h);
+                nextRephase = stats.conflicts +
+                              (phases.getNumRephases() + 1) * RephaseInterval;
+                continue;
+            }
+
+            if (withRestartPolicy(h, [](const auto &policy) {
+                    return policy.shouldRestart();
+                })) {
+                restart(n, h);
+                if constexpr (requires { h.useTargetPhases(); }) {
+                    useTargetPhases = h.useTargetPhases();
+                }
+            }
+
+            ++stats.decisions;
+            decide(phases.decide(h(assignments.assignments, n - trail.size()),
+                                 useTargetPhases));
+        }
+    }
+
+    profiler.count("conflicts", stats.conflicts);
+    profiler.count("decisions", stats.decisions);
+    profiler.count("propagations", stats.propagations);
+    profiler.count("learnt clauses", learntClauses.size());
+    profiler.count("learnt literals", stats.learntLiterals);
+    profiler.count("minimized literals", stats.minimizedLiterals);
+    profiler.count("strengthened clauses", stats.strengthenedClauses);
+    profiler.count("clause database reductions", stats.reductions);
+    profiler.count("clauses kept by last reduction", stats.keptClauses);
+    profiler.count("reduction dropped clauses", stats.droppedClauses);
+    profiler.count("restarts", stats.restarts);
+    profiler.count("rephases", phases.getNumRephases());
+    profiler.count("walks", stats.walks);
+    profiler.count("restart reused levels", stats.reusedLevels);
+    profiler.count("chronological backtracks", stats.chronoBacktracks);
+    profiler.count("max restart interval", stats.maxRestartInterval);
+    if constexpr (std::same_as<H, ModeController>) {
+        profiler.count("mode switches", h.getNumSwitches());
+    } else if (const auto *glucose =
+                   std::get_if<GlucoseRestarts>(&restartPolicy)) {
+        profiler.count("blocked restarts", glucose->getNumBlocked());
+    }
+
+    return result;
+}
+
+auto Solver::getModel() const -> std::vector<Literal> {
+    auto values = assignments.assignments;
+    // restores the variables replaced by equivalent literals
+    reconstruction.extend(values);
+    std::vector<Literal> model;
+    model.reserve(trail.size());
+    for (unsigned x = 0; x < values.size(); ++x) {
+        if (values[x] == TruthValue::True) {
+            model.emplace_back(pos(x));
+        } else if (values[x] == TruthValue::False) {
+            model.emplace_back(neg(x));
         }
     }
+
+    return model;
 }
 
 } // namespace sat
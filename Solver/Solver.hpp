@@ -9,12 +9,23 @@
 #define SOLVER_HPP
 
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
-#include <unordered_map>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include "Clause.hpp"
+#include "ClauseArena.hpp"
+#include "clause_set.hpp"
 #include "basic_structures.hpp"
+#include "heuristics.hpp"
+#include "modes.hpp"
+#include "phases.hpp"
+#include "reconstruction.hpp"
+#include "restarts.hpp"
+#include "util/Profiler.hpp"
 
 namespace sat {
 /*
@@ -27,28 +38,251 @@ namespace sat {
 using ClausePointer = std::shared_ptr<Clause>;
 using ConstClausePointer = std::shared_ptr<const Clause>;
 
+/**
+ * @brief Reason of an assignment
+ * @details @copybrief
+ * Either no reason (decisions and assignments made from outside of the
+ * solver), a clause stored in the clause arena or a binary clause. Binary
+ * clauses are not stored in the arena, their reason is the other (falsified)
+ * literal of the clause.
+ */
+class Reason {
+  public:
+    enum class Kind : std::uint32_t { None, Clause, Binary };
+
+  private:
+    std::uint32_t data = 0;
+    Kind kind = Kind::None;
+
+  public:
+    /**
+     * Default Ctor. Creates an empty reason
+     */
+    constexpr Reason() = default;
+
+    /**
+     * Creates the reason for an assignment implied by a clause in the arena
+     * @param ref reference of the clause
+     * @return reason
+     */
+    static Reason clause(ClauseRef ref);
+
+    /**
+     * Creates the reason for an assignment implied by a binary clause
+     * @param other the other (falsified) literal of the binary clause
+     * @return reason
+     */
+    static Reason binary(Literal other);
+
+    /**
+     * Gets the kind of the reason
+     * @return
+     */
+    Kind getKind() const;
+
+    /**
+     * Gets the clause reference. Only valid if kind is Kind::Clause
+     * @return
+     */
+    ClauseRef getClause() const;
+
+    /**
+     * Gets the other literal of the binary clause. Only valid if kind is
+     * Kind::Binary
+     * @return
+     */
+    Literal getLiteral() const;
+
+    bool operator==(const Reason &) const = default;
+};
+
+/**
+ * @brief Per variable assignment information (struct of arrays)
+ */
 class Assignments {
 
   public:
     std::vector<TruthValue> assignments;
+    /// Indexed by literal id: 1 if the literal is true, -1 if it is false, 0
+    /// if it is unassigned. Evaluates a literal with a single load
+    std::vector<std::int8_t> literalValues;
+    std::vector<unsigned> levels;         ///< decision level of the assignment
+    std::vector<Reason> reasons;          ///< reason of the assignment
+    std::vector<unsigned> trailPositions; ///< position on the trail
     Assignments(unsigned numVariables);
     TruthValue operator[](Variable var) const;
     void set(Variable var, TruthValue value);
 };
 
+/**
+ * @brief Entry of a watch list
+ * @details @copybrief
+ * Stores the reference of the watching clause together with a blocker literal
+ * taken from the same clause. If the blocker is satisfied, the clause is
+ * satisfied and can be skipped without loading it.
+ */
+struct Watcher {
+    ClauseRef clause; ///< reference of the clause in Solver::clauses
+    Literal blocker;  ///< some other literal of the clause
+};
+
 /**
  * @brief Main solver class
  */
 class Solver {
     // @TODO private members here
     Assignments assignments;
-    std::vector<Clause> clauses;
-    std::vector<Literal> unitLiterals;
-    // Maps literal value to clauses index
-    std::unordered_map<unsigned, std::vector<size_t>> watchLists;
-    std::vector<size_t> trail;
+    ClauseArena clauses;
+    // References of all problem clauses stored in the arena
+    std::vector<ClauseRef> clauseRefs;
+    // References of all learned clauses stored in the arena
+    std::vector<ClauseRef> learntClauses;
+    // All assigned literals in assignment order
+    std::vector<Literal> trail;
+    // Start of each decision level on the trail
+    std::vector<std::size_t> trailLimits;
+    // Position of the next literal on the trail to propagate
+    std::size_t qhead = 0;
+    // Indexed by literal id, contains the clauses watching that literal
+    std::vector<std::vector<Watcher>> watchLists;
+    // Binary clauses are not stored in the arena. Indexed by literal id,
+    // contains the other literals of all binary clauses with that literal
+    std::vector<std::vector<Literal>> binaryImplications;
+    // Clauses added so far, only set while duplicate clauses are dropped
+    std::optional<ClauseSet> inputClauses;
+    // Set by removeClause, the clause lists still contain removed clauses
+    bool pendingRemovals = false;
+    // Clause of the last conflict. For binary clauses, the reason holds one
+    // literal of the clause and conflictLiteral the other one
+    Reason conflict;
+    Literal conflictLiteral = 0;
+    // Per variable marks used during conflict analysis
+    std::vector<char> seen;
+    // Literals whose seen mark has to be reset after conflict analysis
+    std::vector<Literal> analyzeToClear;
+    // Work stack of the redundancy check during clause minimization
+    std::vector<Literal> analyzeStack;
+    // Antecedent clauses found during conflict analysis that can be
+    // strengthened by removing the given literal
+    std::vector<std::pair<ClauseRef, Literal>> strengthenable;
+    // Indexed by decision level, used to count distinct levels of a clause
+    std::vector<std::size_t> levelStamps;
+    std::size_t currentStamp = 0;
+    // Indexed by variable, parent of a literal implied by the current probe
+    // in its binary implication tree
+    std::vector<Literal> probeParents;
+    // Activity added to learned clauses that take part in conflict analysis
+    double clauseActivityIncrement = 1;
+    // Number of conflicts at which the next clause database reduction happens
+    std::size_t nextReduction = ReductionInterval;
+    // Search statistics, reported to the profiler at the end of the search
+    struct {
+        std::size_t conflicts = 0;
+        std::size_t decisions = 0;
+        std::size_t propagations = 0;
+        std::size_t learntLiterals = 0;
+        std::size_t minimizedLiterals = 0;
+        std::size_t strengthenedClauses = 0;
+        std::size_t reductions = 0;
+        std::size_t keptClauses = 0;
+        std::size_t droppedClauses = 0;
+        std::size_t restarts = 0;
+        std::size_t reusedLevels = 0;
+        std::size_t lastRestart = 0;
+        std::size_t maxRestartInterval = 0;
+        std::size_t walks = 0;
+        std::size_t chronoBacktracks = 0;
+    } stats;
+    // Branching heuristic of the search
+    AnyHeuristic branchingHeuristic;
+    // Number of literals at the start of the trail the heuristic was notified
+    // about
+    std::size_t numNotified = 0;
+    AnyRestartPolicy restartPolicy;
+    // Replaces heuristic and restart policy of the CDCL search if set
+    std::optional<ModeController> modeController;
+    Phases phases;
+    // Whether decisions prefer target phases over saved phases
+    bool useTargetPhases = true;
+    // Number of conflicts at which the next rephase happens
+    std::size_t nextRephase = RephaseInterval;
+    // Number of conflicts at which the next subsumption round happens
+    std::size_t nextSubsumption = SubsumptionInterval;
+    // Number of conflicts at which the next probing round happens
+    std::size_t nextProbing = ProbingInterval;
+    // Restores variables that were replaced by equivalent literals
+    ReconstructionStack reconstruction;
+    // Backjumps over more levels than this only backtrack one level
+    unsigned chronoThreshold = NoChronologicalBacktracking;
+    Profiler profiler;
 
   public:
+    /**
+     * Fraction of the clause arena that may be occupied by deleted clauses
+     * before it is compacted
+     */
+    static constexpr double GarbageFraction = 0.2;
+
+    /**
+     * Learned clauses with at most this literal block distance (core tier) are
+     * never removed
+     */
+    static constexpr unsigned CoreLbd = 2;
+
+    /**
+     * Learned clauses with at most this literal block distance (tier 2) are
+     * kept as long as they take part in conflict analysis between two clause
+     * database reductions. Clauses with a higher literal block distance form
+     * the local tier.
+     */
+    static constexpr unsigned Tier2Lbd = 6;
+
+    /**
+     * Number of conflicts before the first clause database reduction. The
+     * interval grows by ReductionIncrement after every reduction
+     */
+    static constexpr std::size_t ReductionInterval = 2000;
+    static constexpr std::size_t ReductionIncrement = 300;
+
+    /**
+     * Decay factor of the clause activities
+     */
+    static constexpr double ClauseActivityDecay = 0.999;
+
+    /**
+     * Number of conflicts before the first rephase. The k-th rephase happens
+     * k * RephaseInterval conflicts after the previous one
+     */
+    static constexpr std::size_t RephaseInterval = 1000;
+
+    /**
+     * Maximum number of flips of a local search during rephasing
+     */
+    static constexpr std::size_t WalkFlips = 100000;
+
+    /**
+     * Number of conflicts between two rounds of subsumption during the search
+     */
+    static constexpr std::size_t SubsumptionInterval = 10000;
+
+    /**
+     * Number of conflicts between two rounds of failed literal probing during
+     * the search
+     */
+    static constexpr std::size_t ProbingInterval = 10000;
+
+    /**
+     * Maximum number of propagated literals of one round of failed literal
+     * probing
+     */
+    static constexpr std::size_t ProbingBudget = 1'000'000;
+
+    /**
+     * Threshold that disables chronological backtracking
+     */
+    static constexpr unsigned NoChronologicalBacktracking =
+        std::numeric_limits<unsigned>::max();
+
     /**
      * Ctor. Allocates enough space for the variables.
      * @param numVariables Number of variables in the problem
@@ -68,16 +302,177 @@ class Solver {
      */
 
     /**
-     * Adds a clause to the solver.
+     * Adds a clause to the solver. Duplicate literals, falsified literals and
+     * tautologies are removed. If enabled, clauses with the same literals as
+     * a clause added before are dropped (see setClauseDeduplication). Must be
+     * called before the first decision.
      * @param clause The clause to add
      * @return bool true if clause was successfully added, false if clause is
      * empty or unit and violates the current model
      */
-    bool addClause(Clause clause);
+    bool addClause(const Clause &clause);
+
+    /**
+     * Gets the references of all problem clauses stored in the solver. Unit
+     * clauses
+     * are not stored as clauses but directly assigned, binary clauses are
+     * stored as implications (see getBinaryImplications).
+     * @return clause references. Removed clauses are contained until the next
+     * garbage collection
+     */
+    auto getClauseRefs() const -> const std::vector<ClauseRef> &;
+
+    /**
+     * Gets the references of all learned clauses with more than two literals
+     * @return clause references. Removed clauses are contained until the next
+     * garbage collection
+     */
+    auto getLearntClauseRefs() const -> const std::vector<ClauseRef> &;
+
+    /**
+     * Gets the other literals of all binary clauses containing the given
+     * literal. These literals are implied when l is falsified.
+     * @param l literal
+     * @return implied literals
+     */
+    auto getBinaryImplications(Literal l) const -> const std::vector<Literal> &;
+
+    /**
+     * Gets a clause stored in the solver
+     * @param ref reference of the clause
+     * @return read-only handle to the clause. Invalidated when clauses are
+     * added.
+     */
+    ConstClauseView getClause(ClauseRef ref) const;
+
+    /**
+     * Removes a clause from the solver. Its watchers are removed immediately,
+     * its memory is reclaimed by the next garbage collection.
+     * @param ref reference of the clause
+     * @note the clause must not be used as a reason for a current assignment
+     */
+    void removeClause(ClauseRef ref);
+
+    /**
+     * Removes all clauses that are satisfied by the current assignment,
+     * including binary clauses. Must only be called when no decisions have
+     * been made.
+     * @return number of removed clauses
+     */
+    std::size_t removeSatisfiedClauses();
+
+    /**
+     * Removes subsumed clauses and strengthens clauses by self-subsuming
+     * resolution (see sat::Subsumer). Problem clauses, including binary
+     * clauses, simplify problem and learned clauses. Learned clauses are only
+     * simplified themselves. Clauses that become binary or unit are moved to
+     * the binary implications or assigned. Must only be called when no
+     * decisions have been made.
+     * @return false if the formula is unsatisfiable, true otherwise
+     */
+    bool subsume();
+
+    /**
+     * Failed literal probing. Each literal that is a root of the binary
+     * implication graph (it implies other literals by binary clauses but is
+     * not implied by one) and its negation are assigned at a temporary
+     * decision level and propagated. If a probe leads to a conflict, its
+     * negation is assigned at level 0. Literals implied by both probes of a
+     * variable are assigned at level 0 as well. For every literal implied by a
+     * longer clause, the hyper-binary resolvent (¬dominator ∨ literal) is
+     * added, where the dominator is the closest literal that implies all
+     * falsified literals of the clause through binary clauses.
+     * Stops after ProbingBudget propagated literals. Saved phases are not
+     * changed. Must only be called when no decisions have been made.
+     * @return false if the formula is unsatisfiable, true otherwise
+     */
+    bool probe();
+
+    /**
+     * Equivalent literal substitution. Literals that imply each other through
+     * binary clauses are equivalent (see sat::findEquivalences). Every
+     * variable is replaced by the representative literal of its class in all
+     * clauses, including learned clauses. Replaced variables no longer occur
+     * in any clause. Their values are restored by getModel. Must only be
+     * called when no decisions have been made.
+     * @return false if the formula is unsatisfiable, true otherwise
+     */
+    bool substituteEquivalences();
+
+    /**
+     * Compacts the clause storage. All clause references held by the solver
+     * are relocated, references obtained before are invalidated. Watchers of
+     * deleted clauses are dropped. Pause time and reclaimed bytes are reported
+     * to the profiler.
+     */
+    void collectGarbage();
+
+    /**
+     * Learned clause database reduction. Core clauses (see CoreLbd) and
+     * reasons are kept. Tier 2 clauses (see Tier2Lbd) that were used in
+     * conflict analysis since the last reduction are kept for one more round,
+     * unused ones are demoted to the local tier. Of the local tier, the half
+     * with the highest literal block distance and the lowest activity is
+     * removed, whether the clauses were used or not. Removed clauses are only
+     * marked as deleted, their watchers and memory are reclaimed immediately by
+     * one garbage collection.
+     */
+    void reduceLearntClauses();
+
+    /**
+     * Gets the profiler containing timings and statistics of the solver
+     * @return profiler
+     */
+    const Profiler &getProfiler() const;
+
+    /**
+     * Sets the branching heuristic used by the search. The default is VSIDS.
+     * The heuristic is notified about assignments, backtracking and conflicts
+     * (see sat::hooks). The search loops are instantiated for each built-in
+     * heuristic, custom heuristics are called through sat::Heuristic.
+     * @param h heuristic
+     */
+    void setHeuristic(AnyHeuristic h);
+
+    /**
+     * Sets the restart policy of the CDCL search. The default are glucose
+     * style restarts.
+     * @param policy restart policy
+     */
+    void setRestartPolicy(AnyRestartPolicy policy);
+
+    /**
+     * Enables or disables dropping duplicate clauses in addClause. While
+     * enabled, the solver keeps a hash set of all added clauses. Disabling it
+     * releases the set. Disabled by default.
+     * @param enabled
+     */
+    void setClauseDeduplication(bool enabled);
+
+    /**
+     * Enables or disables switching between focused and stable mode in the
+     * CDCL search (see sat::ModeController). If enabled, the heuristic and
+     * restart policy of the current mode are used instead of the ones set by
+     * setHeuristic and setRestartPolicy. Disabled by default.
+     * @param enabled
+     */
+    void setModeSwitching(bool enabled);
+
+    /**
+     * Enables chronological backtracking in the CDCL search. If conflict
+     * analysis would backjump over more than threshold levels, the search
+     * only backtracks to the previous level and keeps the asserted literal
+     * on the trail at its lower level. The trail is then no longer sorted by
+     * decision level. Disabled by default.
+     * @param threshold minimum backjump distance for chronological
+     * backtracking, NoChronologicalBacktracking to disable it
+     */
+    void setChronologicalBacktracking(unsigned threshold);
 
     /**
      * Returns a reduced set of clauses. Excludes satisfied clauses and removes
-     * falsified literals from clauses
+     * falsified literals from clauses. Reduced clauses with the same literals
+     * are contained once
      * @return equivalent set of clauses
      */
     auto rebase() const -> std::vector<Clause>;
@@ -104,24 +499,263 @@ class Solver {
     bool falsified(Literal l) const;
 
     /**
-     * Assigns the given literal
+     * Assigns the given literal at the current decision level. With
+     * chronological backtracking enabled, implied literals are assigned at
+     * the highest level of the other literals of their reason instead
      * @param l Literal to assign
+     * @param reason reason of the assignment
      * @return false if literal is already falsified, true otherwise
      */
-    bool assign(Literal l);
+    bool assign(Literal l, Reason reason = {});
+
+    /**
+     * Opens a new decision level and assigns the given literal
+     * @param l unassigned literal
+     */
+    void decide(Literal l);
+
+    /**
+     * Current decision level
+     * @return number of decisions on the trail
+     */
+    unsigned decisionLevel() const;
+
+    /**
+     * Decision level of an assigned variable
+     * @param x variable
+     * @return decision level
+     */
+    unsigned level(Variable x) const;
+
+    /**
+     * Reason of an assigned variable
+     * @param x variable
+     * @return reason
+     */
+    Reason reason(Variable x) const;
+
+    /**
+     * Undoes all assignments above the given decision level. Assignments of
+     * lower levels that are placed above the level on the trail (see
+     * setChronologicalBacktracking) are kept in trail order. The active
+     * heuristic is notified about the unassigned variables
+     * @param level target decision level
+     */
+    void backtrack(unsigned level);
 
     /**
-     * Does the unit propagation.
+     * Does the unit propagation of all literals on the trail that have not
+     * been propagated yet.
      * @return true if unit propagation was successful, false otherwise
      */
     bool unitPropagate();
 
+    /**
+     * Propagates the falsification of a single literal: first assigns the
+     * implications of all binary clauses containing l, then visits all longer
+     * clauses watching l and either moves the watcher or assigns the implied
+     * literal.
+     * @param l falsified literal
+     * @return false if a conflict was found, true otherwise
+     */
     bool unitPropagate(Literal l);
 
-    // Returns watched literal that was replaced
-    Literal set_watcher(size_t clause_index, Literal ci, short rank);
+    /**
+     * Chronological DPLL search using the heuristic of the solver
+     * @param n number of variables
+     * @return true if the formula is satisfiable, false otherwise
+     */
+    bool dpll(unsigned n);
+
+    /**
+     * Conflict driven clause learning search. Learns a clause by first UIP
+     * conflict analysis on every conflict and backjumps non-chronologically.
+     * Uses the heuristic of the solver
+     * @param n number of variables
+     * @return true if the formula is satisfiable, false otherwise
+     */
+    bool cdcl(unsigned n);
+
+    /**
+     * Gets the current assignment as a list of literals. After a successful
+     * search this is a model of the formula. Variables replaced by
+     * substituteEquivalences get the value of their representative
+     * @return assigned literals ordered by variable
+     */
+    auto getModel() const -> std::vector<Literal>;
+
+  private:
+    /**
+     * Adds the watchers of a clause stored in the arena
+     * @param ref clause reference
+     */
+    void attachClause(ClauseRef ref);
+
+    /**
+     * Removes the watchers of a clause stored in the arena
+     * @param ref clause reference
+     */
+    void detachClause(ClauseRef ref);
+
+    /**
+     * Assigns a literal at a new decision level, propagates it and backtracks
+     * to level 0. Adds the hyper-binary resolvents of the probe if it
+     * succeeds
+     * @param l unassigned literal
+     * @param implied output parameter, receives the literals implied by l
+     * @return false if the probe leads to a conflict, true otherwise
+     */
+    bool probeLiteral(Literal l, std::vector<Literal> &implied);
+
+    /**
+     * Sorts the literals of a clause and removes duplicate and falsified
+     * literals
+     * @param literals literals of the clause
+     * @return false if the clause is satisfied or a tautology, true otherwise
+     */
+    bool normalize(std::vector<Literal> &literals) const;
+
+    /**
+     * Drops removed clauses from the clause references
+     */
+    void purgeRemovedClauses();
 
-    bool dpll(unsigned);
+    /**
+     * Search loops specialized on the heuristic type, see dpll and cdcl
+     */
+    template<heuristic H> bool dpllSearch(unsigned n, H &h);
+
+    template<heuristic H> bool cdclSearch(unsigned n, H &h);
+
+    /**
+     * Notifies the heuristic about all trail literals assigned since the last
+     * notification
+     * @param h heuristic
+     */
+    template<heuristic H> void notifyAssignments(H &h);
+
+    /**
+     * Undoes all assignments above the given decision level without notifying
+     * the heuristic (see backtrack)
+     * @param level target decision level
+     */
+    void undoAssignments(unsigned level);
+
+    /**
+     * Notifies the heuristic about the unassigned variables and backtracks
+     * @param level target decision level
+     * @param h heuristic
+     */
+    template<heuristic H> void backtrack(unsigned level, H &h);
+
+    /**
+     * Restarts the search. Keeps the decision levels whose decision variables
+     * have a higher score than the next decision (trail reuse). Heuristics
+     * without a score function restart from level 0. The restart policy is
+     * informed first, so after a mode switch the scores of the new mode are
+     * used
+     * @param n number of variables
+     * @param h heuristic
+     */
+    template<heuristic H> void restart(unsigned n, H &h);
+
+    /**
+     * Backtracks to level 0 and overwrites the saved phases with the next
+     * method of Phases::Schedule
+     * @param h heuristic
+     */
+    template<heuristic H> void rephase(H &h);
+
+    /**
+     * Calls f with the restart policy of the CDCL search. This is the
+     * heuristic itself if it is also a restart policy (see
+     * sat::ModeController)
+     * @param h heuristic
+     * @param f callable
+     * @return result of f
+     */
+    template<heuristic H, typename F>
+    decltype(auto) withRestartPolicy(H &h, F &&f);
+
+    /**
+     * Collects the clauses that are not satisfied at level 0 without their
+     * falsified literals, including binary clauses
+     * @return clauses
+     */
+    auto unsatisfiedClauses() const -> std::vector<std::vector<Literal>>;
+
+    /**
+     * Level at which the given reason implies a literal
+     * @param reason reason of an implied literal
+     * @return highest level of the other literals of the reason
+     */
+    unsigned assignmentLevel(Reason reason) const;
+
+    /**
+     * Highest decision level of the literals of the conflict clause. Differs
+     * from the current level only with chronological backtracking
+     * @return level of the conflict
+     */
+    unsigned conflictLevel() const;
+
+    /**
+     * First UIP conflict analysis of the last conflict. The learned clause is
+     * minimized recursively. Antecedent clauses that are subsumed by an
+     * intermediate resolvent are recorded for strengthening.
+     * @param learnt output parameter, receives the learned clause. The
+     * asserting literal is at position 0, a literal of the backjump level at
+     * position 1
+     * @param h heuristic, receives the bumped and reason side variables
+     * @return backjump level
+     */
+    template<heuristic H>
+    unsigned analyzeConflict(std::vector<Literal> &learnt, H &h);
+
+    /**
+     * Checks whether a literal of the learned clause is implied by the other
+     * literals of the learned clause
+     * @param l literal of the learned clause with a reason
+     * @param abstractLevels union of the abstract levels of the learned
+     * clause
+     * @return true if l can be removed from the learned clause
+     */
+    bool isRedundant(Literal l, std::uint32_t abstractLevels);
+
+    /**
+     * Removes the pivot literals from the antecedent clauses recorded by the
+     * last conflict analysis. Must be called after backjumping
+     */
+    void strengthenAntecedents();
+
+    /**
+     * Adds a learned clause and assigns its asserting literal. Must be called
+     * after backjumping
+     * @param learnt learned clause as returned by analyzeConflict
+     * @param lbd literal block distance of the learned clause
+     */
+    void addLearntClause(const std::vector<Literal> &learnt, unsigned lbd);
+
+    /**
+     * Computes the literal block distance of a clause, the number of distinct
+     * decision levels of its literals
+     * @param clause clause with assigned literals
+     * @return literal block distance
+     */
+    template<clause_like C>
+    unsigned computeLbd(const C &clause);
+
+    /**
+     * Increases the activity of a learned clause
+     * @param c learned clause
+     */
+    void bumpClauseActivity(ClauseView c);
+
+    /**
+     * Whether the clause is the reason of a current assignment
+     * @param ref clause reference
+     * @return
+     */
+    bool isLocked(ClauseRef ref) const;
 };
 } // namespace sat
 
@@ -8,16 +8,16 @@
 #ifndef BASIC_STRUCTURES_HPP
 #define BASIC_STRUCTURES_HPP
 
-/* These are only the declarations of the classes and their members
- * @TODO implementation in basic_structures.cpp
- */
+#include <cstdint>
+
+/* All members are defined inline, literals are evaluated in the innermost loops of the solver */
 
 namespace sat {
 
     /**
      * @brief Represents a truth value
      */
-    enum class TruthValue {
+    enum class TruthValue : std::int8_t {
         False = -1, ///< variable is false
         Undefined = 0, ///< variable is unassigned
         True = 1 ///< variable is true
@@ -34,19 +34,23 @@ namespace sat {
          * CTor
          * @param val variable number (name of the variable)
          */
-        Variable(unsigned val);
+        constexpr Variable(unsigned val) noexcept : id(val) {}
 
         /**
          * gets the underlying variable number
          * @return
          */
-        unsigned get() const;
+        constexpr unsigned get() const noexcept {
+            return id;
+        }
 
         /**
          * Compares the underlying variable identifier
          * @return True if both variables are the same (have the same identifier)
          */
-        bool operator==(Variable other) const;
+        constexpr bool operator==(Variable other) const noexcept {
+            return id == other.id;
+        }
     };
 
     /**
@@ -64,31 +68,39 @@ namespace sat {
          * identifier stands for a negative literal, an odd one for a positive
          * see also sat::pos and sat::neg
          */
-        Literal(unsigned val);
+        constexpr Literal(unsigned val) noexcept : id(val) {}
 
         /**
          * Gets the underlying literal identifier
          * @return the literal identifier
          */
-        unsigned get() const;
+        constexpr unsigned get() const noexcept {
+            return id;
+        }
 
         /**
          * Gets the negated literal
          * @return the negated literal
          */
-        Literal negate() const;
+        constexpr Literal negate() const noexcept {
+            return Literal(id ^ 1u);
+        }
 
         /**
          * Gets the sign of the literal
          * @return -1 if negative literal, +1 else
          */
-        short sign() const;
+        constexpr short sign() const noexcept {
+            return static_cast<short>(2 * static_cast<int>(id & 1u) - 1);
+        }
 
         /**
          * Compares underlying literal identifiers
          * @return True if both literals are exactly the same (sign and variable)
          */
-        bool operator==(Literal) const;
+        constexpr bool operator==(Literal other) const noexcept {
+            return id == other.id;
+        }
     };
 
     /**
@@ -96,21 +108,27 @@ namespace sat {
      * @param x Variable for which to create the literal
      * @return positive literal of x
      */
-    Literal pos(Variable x);
+    constexpr Literal pos(Variable x) noexcept {
+        return Literal(x.get() * 2 + 1);
+    }
 
     /**
      * Creates the negative Literal for a given variable
      * @param x Variable for which to create the literal
      * @return negative literal of x
      */
-    Literal neg(Variable x);
+    constexpr Literal neg(Variable x) noexcept {
+        return Literal(x.get() * 2);
+    }
 
     /**
      * Gets the corresponding Variable of a Literal
      * @param l
      * @return Variable of given Literal
      */
-    Variable var(Literal l);
+    constexpr Variable var(Literal l) noexcept {
+        return Variable(l.get() / 2);
+    }
 
 }
 
@@ -0,0 +1,42 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include <algorithm>
+#include <cassert>
+
+#include "clause_set.hpp"
+
+namespace sat {
+
+    bool ClauseSet::insert(std::span<const Literal> literals) {
+        return clauses.insert(makeEntry(literals, false)).second;
+    }
+
+    bool ClauseSet::insertSorted(std::span<const Literal> literals) {
+        assert(std::ranges::is_sorted(literals, {}, [](Literal l) { return l.get(); }));
+        return clauses.insert(makeEntry(literals, true)).second;
+    }
+
+    bool ClauseSet::contains(std::span<const Literal> literals) const {
+        return clauses.contains(makeEntry(literals, false));
+    }
+
+    std::size_t ClauseSet::size() const {
+        return clauses.size();
+    }
+
+    void ClauseSet::reserve(std::size_t numClauses) {
+        clauses.reserve(numClauses);
+    }
+
+    auto ClauseSet::makeEntry(std::span<const Literal> literals, bool sorted) -> Entry {
+        Entry entry{{literals.begin(), literals.end()}, clauseHash(literals)};
+        if (!sorted) {
+            std::ranges::sort(entry.literals, {}, [](Literal l) { return l.get(); });
+        }
+
+        return entry;
+    }
+}
@@ -0,0 +1,103 @@
+/**
+* @date 17.10.26
+* @file clause_set.hpp
+* @brief Contains a hash set of clauses used to detect duplicate clauses
+*/
+
+#ifndef CLAUSE_SET_HPP
+#define CLAUSE_SET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <unordered_set>
+#include <vector>
+
+#include "basic_structures.hpp"
+
+namespace sat {
+
+    /**
+     * Order independent hash of a clause. Each literal is mixed separately and the results are added, so the hash
+     * does not depend on the order of the literals
+     * @param literals literals of the clause
+     * @return
+     */
+    constexpr std::uint64_t clauseHash(std::span<const Literal> literals) noexcept {
+        std::uint64_t result = literals.size();
+        for (auto l : literals) {
+            // splitmix64 finalizer
+            std::uint64_t h = l.get() + 0x9e3779b97f4a7c15ull;
+            h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ull;
+            h = (h ^ (h >> 27)) * 0x94d049bb133111ebull;
+            result += h ^ (h >> 31);
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Set of clauses independent of the order of their literals.
+     * @details @copybrief
+     * Clauses are stored with sorted literals together with their hash (see clauseHash). Two clauses are only
+     * compared literal by literal if their hashes are equal, so inserting n clauses takes expected linear time in the
+     * total number of literals.
+     */
+    class ClauseSet {
+        struct Entry {
+            std::vector<Literal> literals;
+            std::uint64_t hash;
+
+            bool operator==(const Entry &other) const {
+                return hash == other.hash && literals == other.literals;
+            }
+        };
+
+        struct Hash {
+            std::size_t operator()(const Entry &entry) const noexcept {
+                return static_cast<std::size_t>(entry.hash);
+            }
+        };
+
+        std::unordered_set<Entry, Hash> clauses;
+    public:
+        /**
+         * Inserts a clause
+         * @param literals literals of the clause in any order, must not contain duplicates
+         * @return true if the clause was inserted, false if the set already contains a clause with the same literals
+         */
+        bool insert(std::span<const Literal> literals);
+
+        /**
+         * Inserts a clause whose literals are already sorted by their id. Avoids copying and sorting the literals twice
+         * when the caller sorted them anyway
+         * @param literals literals of the clause sorted by id, must not contain duplicates
+         * @return true if the clause was inserted, false if the set already contains a clause with the same literals
+         */
+        bool insertSorted(std::span<const Literal> literals);
+
+        /**
+         * Checks whether the set contains a clause
+         * @param literals literals of the clause in any order, must not contain duplicates
+         * @return true if a clause with the same literals was inserted before
+         */
+        bool contains(std::span<const Literal> literals) const;
+
+        /**
+         * Number of clauses in the set
+         * @return
+         */
+        std::size_t size() const;
+
+        /**
+         * Reserves space for the given number of clauses
+         * @param numClauses
+         */
+        void reserve(std::size_t numClauses);
+
+    private:
+        static Entry makeEntry(std::span<const Literal> literals, bool sorted);
+    };
+}
+
+#endif //CLAUSE_SET_HPP
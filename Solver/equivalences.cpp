@@ -0,0 +1,98 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+
+#include "equivalences.hpp"
+
+namespace sat {
+
+    auto findEquivalences(const std::vector<std::vector<Literal>> &binaryImplications)
+        -> std::optional<std::vector<Literal>> {
+        constexpr auto Unvisited = std::numeric_limits<std::uint32_t>::max();
+        const auto numLiterals = static_cast<std::uint32_t>(binaryImplications.size());
+        std::vector<Literal> representatives;
+        representatives.reserve(numLiterals);
+        for (std::uint32_t id = 0; id < numLiterals; ++id) {
+            representatives.emplace_back(id);
+        }
+
+        std::vector<std::uint32_t> indices(numLiterals, Unvisited);
+        std::vector<std::uint32_t> lowLinks(numLiterals, 0);
+        std::vector<char> onStack(numLiterals, 0);
+        std::vector<std::uint32_t> stack;
+        // literal and index of its next successor, replaces the recursion of the original algorithm
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> callStack;
+        std::uint32_t nextIndex = 0;
+        const auto visit = [&](std::uint32_t l) {
+            indices[l] = lowLinks[l] = nextIndex++;
+            stack.emplace_back(l);
+            onStack[l] = 1;
+            callStack.emplace_back(l, 0);
+        };
+
+        for (std::uint32_t root = 0; root < numLiterals; ++root) {
+            if (indices[root] != Unvisited) {
+                continue;
+            }
+
+            visit(root);
+            while (not callStack.empty()) {
+                const auto [l, next] = callStack.back();
+                // l is true, so its negation is falsified and implies the other literals of its binary clauses
+                const auto &successors = binaryImplications[Literal(l).negate().get()];
+                if (next < successors.size()) {
+                    ++callStack.back().second;
+                    const auto w = successors[next].get();
+                    if (indices[w] == Unvisited) {
+                        visit(w);
+                    } else if (onStack[w]) {
+                        lowLinks[l] = std::min(lowLinks[l], indices[w]);
+                    }
+
+                    continue;
+                }
+
+                callStack.pop_back();
+                if (not callStack.empty()) {
+                    const auto parent = callStack.back().first;
+                    lowLinks[parent] = std::min(lowLinks[parent], lowLinks[l]);
+                }
+
+                if (lowLinks[l] != indices[l]) {
+                    continue;
+                }
+
+                // l is the root of a component, its literals are on top of the stack
+                auto first = stack.size();
+                do {
+                    --first;
+                } while (stack[first] != l);
+
+                const auto component = std::span(stack).subspan(first);
+                // literal ids are ordered by variable
+                const Literal representative(std::ranges::min(component));
+                for (auto w : component) {
+                    onStack[w] = 0;
+                    representatives[w] = representative;
+                }
+
+                stack.resize(first);
+            }
+        }
+
+        for (std::uint32_t id = 0; id < numLiterals; id += 2) {
+            if (representatives[id] == representatives[id + 1]) {
+                return std::nullopt;
+            }
+        }
+
+        return representatives;
+    }
+}
@@ -0,0 +1,31 @@
+/**
+* @date 17.10.26
+* @file equivalences.hpp
+* @brief Contains the detection of equivalent literals in the binary implication graph
+*/
+
+#ifndef EQUIVALENCES_HPP
+#define EQUIVALENCES_HPP
+
+#include <optional>
+#include <vector>
+
+#include "basic_structures.hpp"
+
+namespace sat {
+
+    /**
+     * Finds equivalent literals. The binary clause (a ∨ b) induces the implications ¬a → b and ¬b → a. All literals
+     * of a strongly connected component of this implication graph are equivalent. The components are computed by an
+     * iterative version of Tarjan's algorithm, so the call stack does not grow with the size of the graph.
+     * @param binaryImplications indexed by literal id, the other literals of all binary clauses containing the
+     * literal (see Solver::getBinaryImplications)
+     * @return representative of every literal indexed by literal id: the literal of its component with the smallest
+     * variable. The representative of ¬l is always the negation of the representative of l. std::nullopt if a
+     * literal is equivalent to its negation, then the clauses are unsatisfiable
+     */
+    auto findEquivalences(const std::vector<std::vector<Literal>> &binaryImplications)
+        -> std::optional<std::vector<Literal>>;
+}
+
+#endif //EQUIVALENCES_HPP
@@ -4,12 +4,36 @@
 * @brief
 */
 
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
 #include <Iterators.hpp>
 
 #include "heuristics.hpp"
 #include "util/exception.hpp"
 
 namespace sat {
+    namespace {
+        /**
+         * Gets the unassigned variable with the largest key. Assigned variables are removed lazily. The selected
+         * variable stays in the heap, so that selection does not change the heap when the caller does not assign the
+         * variable
+         */
+        Variable selectFromHeap(IndexedHeap<double> &heap, const std::vector<TruthValue> &model) {
+            while (not heap.empty()) {
+                const auto x = heap.top();
+                if (model[x] == TruthValue::Undefined) {
+                    return x;
+                }
+
+                heap.pop();
+            }
+
+            throw std::runtime_error("Found no open variable");
+        }
+    }
 
     Variable FirstVariable::operator()(const std::vector<TruthValue> &model, std::size_t) const {
         for (auto [varId, val]: iterators::enumerate(model, 0u)) {
@@ -21,6 +45,162 @@ namespace sat {
         throw std::runtime_error("Found no open variable");
     }
 
+    VSIDS::VSIDS(std::size_t numVariables, double decay) : heap(numVariables, 0.0), decay(decay) {
+        for (unsigned x = 0; x < numVariables; ++x) {
+            heap.push(x);
+        }
+    }
+
+    Variable VSIDS::operator()(const std::vector<TruthValue> &model, std::size_t) {
+        return selectFromHeap(heap, model);
+    }
+
+    void VSIDS::onBump(Variable x) {
+        const auto activity = heap.key(x.get()) + increment;
+        heap.setKey(x.get(), activity);
+        if (activity > RescaleLimit) {
+            heap.scaleKeys(1 / RescaleLimit);
+            increment /= RescaleLimit;
+        }
+    }
+
+    void VSIDS::onConflict() {
+        increment /= decay;
+    }
+
+    void VSIDS::onUnassign(Variable x) {
+        heap.push(x.get());
+    }
+
+    double VSIDS::score(Variable x) const {
+        return heap.key(x.get());
+    }
+
+    LRB::LRB(std::size_t numVariables) : heap(numVariables, 0.0), assignedAt(numVariables, 0),
+                                         participated(numVariables, 0), reasoned(numVariables, 0) {
+        for (unsigned x = 0; x < numVariables; ++x) {
+            heap.push(x);
+        }
+    }
+
+    Variable LRB::operator()(const std::vector<TruthValue> &model, std::size_t) {
+        return selectFromHeap(heap, model);
+    }
+
+    void LRB::onBump(Variable x) {
+        ++participated[x.get()];
+    }
+
+    void LRB::onReasonSide(Variable x) {
+        ++reasoned[x.get()];
+    }
+
+    void LRB::onConflict() {
+        ++conflicts;
+        stepSize = std::max(MinStepSize, stepSize - StepSizeDecrement);
+    }
+
+    void LRB::onAssign(Variable x) {
+        assignedAt[x.get()] = conflicts;
+        participated[x.get()] = 0;
+        reasoned[x.get()] = 0;
+    }
+
+    void LRB::onUnassign(Variable x) {
+        const auto id = x.get();
+        if (const auto interval = conflicts - assignedAt[id]; interval > 0) {
+            const auto reward = static_cast<double>(participated[id] + reasoned[id]) / static_cast<double>(interval);
+            heap.setKey(id, (1 - stepSize) * heap.key(id) + stepSize * reward);
+        }
+
+        heap.push(id);
+    }
+
+    double LRB::score(Variable x) const {
+        return heap.key(x.get());
+    }
+
+    VMTF::VMTF(std::size_t numVariables) : prev(numVariables, None), next(numVariables, None),
+                                           stamps(numVariables, 0) {
+        // variables with small ids end up at the end of the queue and are selected first
+        for (auto x = static_cast<unsigned>(numVariables); x > 0; --x) {
+            moveToEnd(x - 1);
+        }
+
+        search = last;
+    }
+
+    Variable VMTF::operator()(const std::vector<TruthValue> &model, std::size_t) {
+        while (search != None && model[search] != TruthValue::Undefined) {
+            search = prev[search];
+        }
+
+        if (search == None) {
+            throw std::runtime_error("Found no open variable");
+        }
+
+        return search;
+    }
+
+    void VMTF::onBump(Variable x) {
+        bumped.emplace_back(x.get());
+    }
+
+    void VMTF::onConflict() {
+        // bumping in stamp order preserves the relative order of the bumped variables
+        std::ranges::sort(bumped, {}, [this](unsigned x) { return stamps[x]; });
+        for (auto x : bumped) {
+            moveToEnd(x);
+        }
+
+        // the bumped variables are unassigned by the following backjump, which moves the search position
+        bumped.clear();
+    }
+
+    void VMTF::onUnassign(Variable x) {
+        if (search == None || stamps[x.get()] > stamps[search]) {
+            search = x.get();
+        }
+    }
+
+    std::uint64_t VMTF::score(Variable x) const {
+        return stamps[x.get()];
+    }
+
+    void VMTF::moveToEnd(unsigned x) {
+        if (x == last) {
+            stamps[x] = ++currentStamp;
+            return;
+        }
+
+        // unlink
+        if (prev[x] != None) {
+            next[prev[x]] = next[x];
+        } else if (first == x) {
+            first = next[x];
+        }
+
+        if (next[x] != None) {
+            prev[next[x]] = prev[x];
+        }
+
+        if (search == x) {
+            search = prev[x] != None ? prev[x] : next[x];
+        }
+
+        // append
+        prev[x] = last;
+        next[x] = None;
+        if (last != None) {
+            next[last] = x;
+        } else {
+            first = x;
+        }
+
+        last = x;
+        stamps[x] = ++currentStamp;
+    }
+
     Variable Heuristic::operator()(const std::vector<TruthValue> &values, std::size_t numOpenVariables) const {
         if (nullptr == impl) {
             throw BadHeuristicCall("heuristic wrapper does not contain a heuristic");
@@ -29,7 +209,45 @@ namespace sat {
         return impl->invoke(values, numOpenVariables);
     }
 
+    void Heuristic::onBump(Variable x) {
+        impl->onBump(x);
+    }
+
+    void Heuristic::onReasonSide(Variable x) {
+        impl->onReasonSide(x);
+    }
+
+    void Heuristic::onConflict() {
+        impl->onConflict();
+    }
+
+    void Heuristic::onAssign(Variable x) {
+        impl->onAssign(x);
+    }
+
+    void Heuristic::onUnassign(Variable x) {
+        impl->onUnassign(x);
+    }
+
     bool Heuristic::isValid() const {
         return nullptr != impl;
     }
+
+    AnyHeuristic makeHeuristic(const std::string &name, std::size_t numVariables) {
+        using Factory = AnyHeuristic (*)(std::size_t);
+        static constexpr std::array<std::pair<std::string_view, Factory>, 4> factories{{
+            {"vsids", [](std::size_t n) -> AnyHeuristic { return VSIDS(n); }},
+            {"vmtf", [](std::size_t n) -> AnyHeuristic { return VMTF(n); }},
+            {"lrb", [](std::size_t n) -> AnyHeuristic { return LRB(n); }},
+            {"first", [](std::size_t) -> AnyHeuristic { return FirstVariable(); }}
+        }};
+
+        for (const auto &[factoryName, factory] : factories) {
+            if (factoryName == name) {
+                return factory(numVariables);
+            }
+        }
+
+        throw std::invalid_argument("Unknown heuristic " + name);
+    }
 }
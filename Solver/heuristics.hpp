@@ -8,11 +8,16 @@
 #ifndef HEURISTICS_HPP
 #define HEURISTICS_HPP
 
-#include <vector>
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <string>
+#include <variant>
+#include <vector>
 
 #include "basic_structures.hpp"
 #include "util/concepts.hpp"
+#include "util/IndexedHeap.hpp"
 
 namespace sat {
     /**
@@ -23,6 +28,56 @@ namespace sat {
     template<typename H>
     concept heuristic = concepts::callable_r<H, Variable, const std::vector<TruthValue>, std::size_t>;
 
+    /**
+     * @brief Optional hooks of a heuristic.
+     * @details @copybrief
+     * A heuristic can react to search events by implementing any of the member functions
+     * - onBump(Variable x): x took part in conflict analysis
+     * - onReasonSide(Variable x): x occurs in the reason of a literal of the learned clause, but not in the learned
+     *   clause itself
+     * - onConflict(): called once per conflict after all variables of the conflict were bumped
+     * - onAssign(Variable x): x was assigned
+     * - onUnassign(Variable x): x was unassigned by backtracking
+     *
+     * The functions in this namespace call the respective hook if the heuristic implements it and do nothing otherwise.
+     */
+    namespace hooks {
+        template<typename H>
+        void bump(H &h, Variable x) {
+            if constexpr (requires { h.onBump(x); }) {
+                h.onBump(x);
+            }
+        }
+
+        template<typename H>
+        void reasonSide(H &h, Variable x) {
+            if constexpr (requires { h.onReasonSide(x); }) {
+                h.onReasonSide(x);
+            }
+        }
+
+        template<typename H>
+        void conflict(H &h) {
+            if constexpr (requires { h.onConflict(); }) {
+                h.onConflict();
+            }
+        }
+
+        template<typename H>
+        void assign(H &h, Variable x) {
+            if constexpr (requires { h.onAssign(x); }) {
+                h.onAssign(x);
+            }
+        }
+
+        template<typename H>
+        void unassign(H &h, Variable x) {
+            if constexpr (requires { h.onUnassign(x); }) {
+                h.onUnassign(x);
+            }
+        }
+    }
+
     /**
      * @brief Variable selection strategy that selects the first unassigned variable
      */
@@ -30,6 +85,161 @@ namespace sat {
         Variable operator()(const std::vector<TruthValue> &model, std::size_t) const;
     };
 
+    /**
+     * @brief Exponential variable state independent decaying sum heuristic (EVSIDS).
+     * @details @copybrief
+     * Selects the unassigned variable with the highest activity. Variables in conflict analysis are bumped by an
+     * increment that grows geometrically with every conflict, which is equivalent to decaying all activities.
+     * Unassigned variables are kept in an indexed heap, assigned variables are dropped lazily when they reach the top
+     * and reinserted when they are unassigned. Selection is O(log n).
+     */
+    class VSIDS {
+        IndexedHeap<double> heap;
+        double increment = 1;
+        double decay;
+    public:
+        /**
+         * Activity above which all activities are scaled down
+         */
+        static constexpr double RescaleLimit = 1e100;
+
+        /**
+         * CTor
+         * @param numVariables number of variables
+         * @param decay activity decay factor in (0, 1)
+         */
+        explicit VSIDS(std::size_t numVariables, double decay = 0.95);
+
+        /**
+         * Gets the unassigned variable with the highest activity
+         * @param model current assignment
+         * @return unassigned variable
+         * @throws std::runtime_error if all variables are assigned
+         */
+        Variable operator()(const std::vector<TruthValue> &model, std::size_t);
+
+        void onBump(Variable x);
+
+        void onConflict();
+
+        void onUnassign(Variable x);
+
+        /**
+         * Activity of a variable
+         * @param x
+         * @return
+         */
+        double score(Variable x) const;
+    };
+
+    /**
+     * @brief Learning rate based branching heuristic (LRB).
+     * @details @copybrief
+     * Treats branching as a multi-armed bandit problem. The reward of a variable is its learning rate, the fraction of
+     * conflicts during its last assignment in which it took part in conflict analysis, plus a bonus for occurring in
+     * the reasons of learned clauses. Scores are exponential recency weighted averages of the rewards with a step
+     * size that decreases from 0.4 to 0.06. Unassigned variables are kept in an indexed heap like in VSIDS.
+     */
+    class LRB {
+        IndexedHeap<double> heap;
+        std::vector<std::uint64_t> assignedAt;
+        std::vector<std::uint32_t> participated;
+        std::vector<std::uint32_t> reasoned;
+        std::uint64_t conflicts = 0;
+        double stepSize = InitialStepSize;
+    public:
+        static constexpr double InitialStepSize = 0.4;
+        static constexpr double MinStepSize = 0.06;
+        static constexpr double StepSizeDecrement = 1e-6;
+
+        /**
+         * CTor
+         * @param numVariables number of variables
+         */
+        explicit LRB(std::size_t numVariables);
+
+        /**
+         * Gets the unassigned variable with the highest score
+         * @param model current assignment
+         * @return unassigned variable
+         * @throws std::runtime_error if all variables are assigned
+         */
+        Variable operator()(const std::vector<TruthValue> &model, std::size_t);
+
+        void onBump(Variable x);
+
+        void onReasonSide(Variable x);
+
+        void onConflict();
+
+        void onAssign(Variable x);
+
+        /**
+         * Updates the score of x with the reward of its last assignment and reinserts it into the heap
+         * @param x
+         */
+        void onUnassign(Variable x);
+
+        /**
+         * Score of a variable
+         * @param x
+         * @return
+         */
+        double score(Variable x) const;
+    };
+
+    /**
+     * @brief Variable move-to-front heuristic (VMTF).
+     * @details @copybrief
+     * Variables are kept in a doubly linked queue ordered by the time they were last bumped. Bumped variables are
+     * moved to the end of the queue and the unassigned variable closest to the end is selected. A cached search
+     * position, behind which all variables are assigned, makes selection and bumping amortized O(1).
+     */
+    class VMTF {
+        static constexpr unsigned None = std::numeric_limits<unsigned>::max();
+        std::vector<unsigned> prev;
+        std::vector<unsigned> next;
+        std::vector<std::uint64_t> stamps;
+        std::vector<unsigned> bumped;
+        std::uint64_t currentStamp = 0;
+        unsigned first = None;
+        unsigned last = None;
+        unsigned search = None;
+    public:
+        /**
+         * CTor
+         * @param numVariables number of variables
+         */
+        explicit VMTF(std::size_t numVariables);
+
+        /**
+         * Gets the unassigned variable that was bumped most recently
+         * @param model current assignment
+         * @return unassigned variable
+         * @throws std::runtime_error if all variables are assigned
+         */
+        Variable operator()(const std::vector<TruthValue> &model, std::size_t);
+
+        void onBump(Variable x);
+
+        /**
+         * Moves the variables bumped since the last conflict to the end of the queue, keeping their relative order
+         */
+        void onConflict();
+
+        void onUnassign(Variable x);
+
+        /**
+         * Time stamp of the last bump of a variable
+         * @param x
+         * @return
+         */
+        std::uint64_t score(Variable x) const;
+
+    private:
+        void moveToEnd(unsigned x);
+    };
+
     namespace detail {
         /**
          * @brief This is a helper class for the implementation of a type erasure heuristic wrapper
@@ -48,6 +258,16 @@ namespace sat {
             HeuristicCallableBase &operator=(const HeuristicCallableBase &) = default;
 
             virtual Variable invoke(const std::vector<TruthValue> &, std::size_t) = 0;
+
+            virtual void onBump(Variable x) = 0;
+
+            virtual void onReasonSide(Variable x) = 0;
+
+            virtual void onConflict() = 0;
+
+            virtual void onAssign(Variable x) = 0;
+
+            virtual void onUnassign(Variable x) = 0;
         };
 
         /**
@@ -64,6 +284,26 @@ namespace sat {
             Variable invoke(const std::vector<TruthValue> &values, std::size_t numOpenVariables) override {
                 return impl(values, numOpenVariables);
             }
+
+            void onBump(Variable x) override {
+                hooks::bump(impl, x);
+            }
+
+            void onReasonSide(Variable x) override {
+                hooks::reasonSide(impl, x);
+            }
+
+            void onConflict() override {
+                hooks::conflict(impl);
+            }
+
+            void onAssign(Variable x) override {
+                hooks::assign(impl, x);
+            }
+
+            void onUnassign(Variable x) override {
+                hooks::unassign(impl, x);
+            }
         };
     }
 
@@ -90,6 +330,19 @@ namespace sat {
 
         Variable operator()(const std::vector<TruthValue> &values, std::size_t numOpenVariables) const;
 
+        /**
+         * Forwards the hooks to the wrapped heuristic (see sat::hooks). Must only be called on valid wrappers
+         */
+        void onBump(Variable x);
+
+        void onReasonSide(Variable x);
+
+        void onConflict();
+
+        void onAssign(Variable x);
+
+        void onUnassign(Variable x);
+
         /**
          * Whether the wrapper holds a valid heuristic
          * @return true if heuristic wrapper is valid, false otherwise
@@ -97,6 +350,21 @@ namespace sat {
         bool isValid() const;
     };
 
+    /**
+     * Any of the built-in heuristics or a type erased custom heuristic. Code that is generic over heuristics visits the
+     * variant once and is instantiated for each alternative, so that hooks of the built-in heuristics are inlined.
+     */
+    using AnyHeuristic = std::variant<VSIDS, VMTF, LRB, FirstVariable, Heuristic>;
+
+    /**
+     * Creates a heuristic by name
+     * @param name one of "vsids", "vmtf", "lrb" or "first"
+     * @param numVariables number of variables
+     * @return heuristic
+     * @throws std::invalid_argument if the name is unknown
+     */
+    AnyHeuristic makeHeuristic(const std::string &name, std::size_t numVariables);
+
     /**
      * @brief Wrapper for heuristics that do not support move construction or assignment
      * @tparam H heuristic type
@@ -116,6 +384,26 @@ namespace sat {
         Variable operator()(const std::vector<TruthValue> &values, std::size_t numOpenVariables) const {
             return h->operator()(values, numOpenVariables);
         }
+
+        void onBump(Variable x) {
+            hooks::bump(*h, x);
+        }
+
+        void onReasonSide(Variable x) {
+            hooks::reasonSide(*h, x);
+        }
+
+        void onConflict() {
+            hooks::conflict(*h);
+        }
+
+        void onAssign(Variable x) {
+            hooks::assign(*h, x);
+        }
+
+        void onUnassign(Variable x) {
+            hooks::unassign(*h, x);
+        }
     };
 }
 
@@ -0,0 +1,67 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include "literal_scan.hpp"
+
+#ifdef SAT_HAS_AVX2_SCAN
+#include <immintrin.h>
+#endif
+
+namespace sat::detail {
+
+    std::size_t findNonFalsifiedScalar(const std::uint32_t *literals, std::size_t size,
+                                       const std::int8_t *values) noexcept {
+        for (std::size_t i = 0; i < size; ++i) {
+            if (values[literals[i]] >= 0) {
+                return i;
+            }
+        }
+
+        return size;
+    }
+
+#ifdef SAT_HAS_AVX2_SCAN
+    __attribute__((target("avx2")))
+    std::size_t findNonFalsifiedAvx2(const std::uint32_t *literals, std::size_t size,
+                                     const std::int8_t *values) noexcept {
+        std::size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            const auto ids = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(literals + i));
+            // gathers 4 bytes per literal, the value is the lowest byte. Shifting it into the top byte moves its sign
+            // into the sign bit of each lane
+            const auto gathered = _mm256_i32gather_epi32(reinterpret_cast<const int *>(values), ids, 1);
+            const auto signs = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_slli_epi32(gathered, 24)));
+            if (const auto open = ~static_cast<unsigned>(signs) & 0xffu; open != 0) {
+                return i + static_cast<std::size_t>(__builtin_ctz(open));
+            }
+        }
+
+        return i + findNonFalsifiedScalar(literals + i, size - i, values);
+    }
+#endif
+
+    bool hasVectorScan() noexcept {
+#ifdef SAT_HAS_AVX2_SCAN
+        // may run during static initialization, before the CPU model is initialized by libgcc
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#else
+        return false;
+#endif
+    }
+
+    namespace {
+        ScanFunction selectScan() noexcept {
+#ifdef SAT_HAS_AVX2_SCAN
+            if (hasVectorScan()) {
+                return findNonFalsifiedAvx2;
+            }
+#endif
+            return findNonFalsifiedScalar;
+        }
+    }
+
+    const ScanFunction findNonFalsifiedImpl = selectScan();
+}
@@ -0,0 +1,85 @@
+/**
+* @date 17.10.26
+* @file literal_scan.hpp
+* @brief Contains the search for non-falsified literals used to find replacement watchers
+*/
+
+#ifndef LITERAL_SCAN_HPP
+#define LITERAL_SCAN_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SAT_HAS_AVX2_SCAN
+#endif
+
+namespace sat {
+
+    /**
+     * Number of bytes that the literal value array needs to be readable past its last element. The vectorized scan
+     * loads four bytes per literal value
+     */
+    constexpr std::size_t ScanPadding = 3;
+
+    /**
+     * Ranges shorter than this are always scanned by the inlined scalar loop
+     */
+    constexpr std::size_t VectorScanThreshold = 8;
+
+    namespace detail {
+        using ScanFunction = std::size_t (*)(const std::uint32_t *, std::size_t, const std::int8_t *);
+
+        /**
+         * Scalar scan, see sat::findNonFalsified
+         */
+        std::size_t findNonFalsifiedScalar(const std::uint32_t *literals, std::size_t size,
+                                           const std::int8_t *values) noexcept;
+
+#ifdef SAT_HAS_AVX2_SCAN
+        /**
+         * AVX2 scan that gathers the values of 8 literals at once, see sat::findNonFalsified. Must only be called if
+         * the CPU supports AVX2
+         */
+        std::size_t findNonFalsifiedAvx2(const std::uint32_t *literals, std::size_t size,
+                                         const std::int8_t *values) noexcept;
+#endif
+
+        /**
+         * Whether the CPU supports the vectorized scan
+         * @return
+         */
+        bool hasVectorScan() noexcept;
+
+        /**
+         * Scan implementation selected once by CPU feature detection
+         */
+        extern const ScanFunction findNonFalsifiedImpl;
+    }
+
+    /**
+     * Finds the first literal in a range that is not falsified. Ranges of at least VectorScanThreshold literals are
+     * scanned with AVX2 if the CPU supports it.
+     * @param literals literal identifiers
+     * @param size number of literals
+     * @param values literal values indexed by literal identifier, negative if the literal is false (see
+     * Assignments::literalValues). Must be readable ScanPadding bytes past the largest literal identifier
+     * @return index of the first literal that is not false, size if all literals are false
+     */
+    inline std::size_t findNonFalsified(const std::uint32_t *literals, std::size_t size,
+                                        const std::int8_t *values) noexcept {
+        if (size < VectorScanThreshold) {
+            for (std::size_t i = 0; i < size; ++i) {
+                if (values[literals[i]] >= 0) {
+                    return i;
+                }
+            }
+
+            return size;
+        }
+
+        return detail::findNonFalsifiedImpl(literals, size, values);
+    }
+}
+
+#endif //LITERAL_SCAN_HPP
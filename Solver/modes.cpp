@@ -0,0 +1,96 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include "modes.hpp"
+
+namespace sat {
+
+    ModeController::ModeController(std::size_t numVariables) : focusedHeuristic(numVariables),
+                                                               stableHeuristic(numVariables) {}
+
+    Variable ModeController::operator()(const std::vector<TruthValue> &model, std::size_t numOpen) {
+        return mode == Mode::Focused ? focusedHeuristic(model, numOpen) : stableHeuristic(model, numOpen);
+    }
+
+    void ModeController::onBump(Variable x) {
+        hooks::bump(focusedHeuristic, x);
+        hooks::bump(stableHeuristic, x);
+    }
+
+    void ModeController::onReasonSide(Variable x) {
+        hooks::reasonSide(focusedHeuristic, x);
+        hooks::reasonSide(stableHeuristic, x);
+    }
+
+    void ModeController::onConflict() {
+        hooks::conflict(focusedHeuristic);
+        hooks::conflict(stableHeuristic);
+    }
+
+    void ModeController::onAssign(Variable x) {
+        hooks::assign(focusedHeuristic, x);
+        hooks::assign(stableHeuristic, x);
+    }
+
+    void ModeController::onUnassign(Variable x) {
+        hooks::unassign(focusedHeuristic, x);
+        hooks::unassign(stableHeuristic, x);
+    }
+
+    double ModeController::score(Variable x) const {
+        return mode == Mode::Focused ? static_cast<double>(focusedHeuristic.score(x)) : stableHeuristic.score(x);
+    }
+
+    void ModeController::onConflict(unsigned lbd, std::size_t trailSize) {
+        ++conflicts;
+        if (mode == Mode::Focused) {
+            focusedRestarts.onConflict(lbd, trailSize);
+        } else {
+            stableRestarts.onConflict(lbd, trailSize);
+        }
+    }
+
+    bool ModeController::shouldRestart() const {
+        if (conflicts >= budget) {
+            return true;
+        }
+
+        return mode == Mode::Focused ? focusedRestarts.shouldRestart() : stableRestarts.shouldRestart();
+    }
+
+    void ModeController::onRestart() {
+        // On a switch, this ends the interval of the outgoing policy. It receives no conflicts while its mode is
+        // inactive, so it starts with fresh counters when its mode is entered again
+        if (mode == Mode::Focused) {
+            focusedRestarts.onRestart();
+        } else {
+            stableRestarts.onRestart();
+        }
+
+        if (conflicts < budget) {
+            return;
+        }
+
+        if (mode == Mode::Stable) {
+            budget *= BudgetFactor;
+        }
+
+        mode = mode == Mode::Focused ? Mode::Stable : Mode::Focused;
+        conflicts = 0;
+        ++numSwitches;
+    }
+
+    bool ModeController::useTargetPhases() const {
+        return mode == Mode::Stable;
+    }
+
+    Mode ModeController::getMode() const {
+        return mode;
+    }
+
+    std::uint64_t ModeController::getNumSwitches() const {
+        return numSwitches;
+    }
+}
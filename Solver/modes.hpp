@@ -0,0 +1,116 @@
+/**
+* @date 17.10.26
+* @file modes.hpp
+* @brief Contains the controller that alternates between focused and stable search
+*/
+
+#ifndef MODES_HPP
+#define MODES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "basic_structures.hpp"
+#include "heuristics.hpp"
+#include "restarts.hpp"
+
+namespace sat {
+
+    /**
+     * @brief Search modes of the CDCL search
+     */
+    enum class Mode {
+        Focused, ///< frequent glucose style restarts, VMTF heuristic, saved phases
+        Stable   ///< rare Luby restarts, VSIDS heuristic, target phases
+    };
+
+    /**
+     * @brief Alternates the CDCL search between focused and stable mode.
+     * @details @copybrief
+     * The controller owns the heuristic and the restart policy of both modes and is used by the search as heuristic
+     * (satisfies sat::heuristic) and as restart policy (satisfies sat::restart_policy) at the same time. Both
+     * heuristics are informed about all search events so that they are up to date when their mode becomes active.
+     * The search starts in focused mode. Each mode lasts for a conflict budget, the budget of the k-th pair of modes
+     * is FirstBudget * BudgetFactor^k conflicts. The mode is switched at the next restart after the budget is
+     * exhausted.
+     */
+    class ModeController {
+        VMTF focusedHeuristic;
+        VSIDS stableHeuristic;
+        GlucoseRestarts focusedRestarts;
+        LubyRestarts stableRestarts{StableRestartUnit};
+        Mode mode = Mode::Focused;
+        std::uint64_t conflicts = 0;
+        std::uint64_t budget = FirstBudget;
+        std::uint64_t numSwitches = 0;
+    public:
+        /// number of conflicts of the first focused mode
+        static constexpr std::uint64_t FirstBudget = 1000;
+        /// growth factor of the budget after each pair of focused and stable mode
+        static constexpr std::uint64_t BudgetFactor = 2;
+        /// unit of the Luby restarts in stable mode
+        static constexpr std::uint64_t StableRestartUnit = 1024;
+
+        /**
+         * CTor
+         * @param numVariables number of variables
+         */
+        explicit ModeController(std::size_t numVariables);
+
+        /**
+         * Gets the decision variable from the heuristic of the current mode
+         * @param model current assignment
+         * @param numOpen number of unassigned variables
+         * @return unassigned variable
+         */
+        Variable operator()(const std::vector<TruthValue> &model, std::size_t numOpen);
+
+        void onBump(Variable x);
+
+        void onReasonSide(Variable x);
+
+        void onConflict();
+
+        void onAssign(Variable x);
+
+        void onUnassign(Variable x);
+
+        /**
+         * Score of a variable in the heuristic of the current mode
+         * @param x
+         * @return
+         */
+        double score(Variable x) const;
+
+        void onConflict(unsigned lbd, std::size_t trailSize);
+
+        /**
+         * Whether the restart policy of the current mode restarts or the budget of the mode is exhausted
+         * @return
+         */
+        bool shouldRestart() const;
+
+        /**
+         * Informs the restart policy of the current mode and switches the mode if its budget is exhausted. The
+         * restart policy of the new mode continues with reset interval counters
+         */
+        void onRestart();
+
+        /**
+         * Whether decisions should prefer target phases in the current mode
+         * @return
+         */
+        bool useTargetPhases() const;
+
+        Mode getMode() const;
+
+        /**
+         * Number of mode switches so far
+         * @return
+         */
+        std::uint64_t getNumSwitches() const;
+    };
+}
+
+#endif //MODES_HPP
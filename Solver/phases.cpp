@@ -0,0 +1,165 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <random>
+
+#include "phases.hpp"
+
+namespace sat {
+
+    Phases::Phases(std::size_t numVariables, bool initial) : saved(numVariables, initial), target(numVariables, Unset),
+                                                             best(numVariables, Unset), initial(initial) {}
+
+    Literal Phases::decide(Variable x, bool useTarget) const {
+        auto phase = saved[x.get()];
+        if (useTarget && target[x.get()] != Unset) {
+            phase = target[x.get()];
+        }
+
+        return phase ? pos(x) : neg(x);
+    }
+
+    void Phases::update(std::span<const Literal> trail) {
+        if (trail.size() > targetSize) {
+            targetSize = trail.size();
+            for (auto l : trail) {
+                target[var(l).get()] = l.sign() > 0;
+            }
+        }
+
+        if (trail.size() > bestSize) {
+            bestSize = trail.size();
+            for (auto l : trail) {
+                best[var(l).get()] = l.sign() > 0;
+            }
+        }
+    }
+
+    auto Phases::nextRephase() -> Rephase {
+        return Schedule[numRephases++ % Schedule.size()];
+    }
+
+    void Phases::rephase(Rephase method) {
+        switch (method) {
+            case Rephase::Original:
+                std::ranges::fill(saved, initial);
+                break;
+            case Rephase::Inverted:
+                std::ranges::fill(saved, not initial);
+                break;
+            case Rephase::Best:
+                for (std::size_t x = 0; x < saved.size(); ++x) {
+                    if (best[x] != Unset) {
+                        saved[x] = best[x];
+                    }
+                }
+
+                bestSize = 0;
+                break;
+            case Rephase::Walk:
+                break;
+        }
+
+        std::ranges::fill(target, Unset);
+        targetSize = 0;
+    }
+
+    std::vector<char> &Phases::getSaved() {
+        return saved;
+    }
+
+    std::size_t Phases::getNumRephases() const {
+        return numRephases;
+    }
+
+    std::size_t walk(const std::vector<std::vector<Literal>> &clauses, std::vector<char> &phases,
+                     std::size_t maxFlips, std::uint64_t seed) {
+        constexpr auto NotUnsat = std::numeric_limits<std::size_t>::max();
+        // probability of a random flip instead of a greedy one
+        constexpr double Noise = 0.2;
+        const auto isTrue = [&phases](Literal l) { return phases[var(l).get()] == (l.sign() > 0); };
+        std::vector<std::vector<std::uint32_t>> occurrences(2 * phases.size());
+        std::vector<std::uint32_t> numTrue(clauses.size(), 0);
+        std::vector<std::size_t> unsatPositions(clauses.size(), NotUnsat);
+        std::vector<std::uint32_t> unsat;
+        for (std::uint32_t c = 0; c < clauses.size(); ++c) {
+            for (auto l : clauses[c]) {
+                occurrences[l.get()].emplace_back(c);
+                numTrue[c] += isTrue(l);
+            }
+
+            if (numTrue[c] == 0) {
+                unsatPositions[c] = unsat.size();
+                unsat.emplace_back(c);
+            }
+        }
+
+        const auto breakCount = [&](Variable x) {
+            // clauses in which the currently true literal of x is the only true literal
+            const auto trueLit = phases[x.get()] ? pos(x) : neg(x);
+            return std::ranges::count_if(occurrences[trueLit.get()], [&numTrue](auto c) { return numTrue[c] == 1; });
+        };
+
+        // variables flipped since the best assignment was found
+        std::vector<Variable> flipped;
+        auto bestUnsat = unsat.size();
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<double> coin(0, 1);
+        for (std::size_t step = 0; step < maxFlips && not unsat.empty(); ++step) {
+            const auto &clause = clauses[unsat[rng() % unsat.size()]];
+            assert(not clause.empty());
+            Variable x = var(clause[rng() % clause.size()]);
+            if (coin(rng) >= Noise) {
+                auto minBreak = breakCount(x);
+                for (auto l : clause) {
+                    if (minBreak == 0) {
+                        break;
+                    }
+
+                    if (const auto b = breakCount(var(l)); b < minBreak) {
+                        minBreak = b;
+                        x = var(l);
+                    }
+                }
+            }
+
+            const auto trueLit = phases[x.get()] ? pos(x) : neg(x);
+            phases[x.get()] = not phases[x.get()];
+            for (auto c : occurrences[trueLit.get()]) {
+                if (--numTrue[c] == 0) {
+                    unsatPositions[c] = unsat.size();
+                    unsat.emplace_back(c);
+                }
+            }
+
+            for (auto c : occurrences[trueLit.negate().get()]) {
+                if (numTrue[c]++ == 0) {
+                    // replace by the last unsatisfied clause
+                    const auto index = unsatPositions[c];
+                    unsat[index] = unsat.back();
+                    unsatPositions[unsat[index]] = index;
+                    unsat.pop_back();
+                    unsatPositions[c] = NotUnsat;
+                }
+            }
+
+            flipped.emplace_back(x);
+            if (unsat.size() < bestUnsat) {
+                bestUnsat = unsat.size();
+                flipped.clear();
+            }
+        }
+
+        // undo the flips after the best assignment
+        for (auto x : flipped) {
+            phases[x.get()] = not phases[x.get()];
+        }
+
+        return bestUnsat;
+    }
+}
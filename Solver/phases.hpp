@@ -0,0 +1,126 @@
+/**
+* @date 17.10.26
+* @file phases.hpp
+* @brief Contains the phase selection of decisions and rephasing
+*/
+
+#ifndef PHASES_HPP
+#define PHASES_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "basic_structures.hpp"
+
+namespace sat {
+
+    /**
+     * @brief Phase (polarity) selection for decision variables.
+     * @details @copybrief
+     * Keeps three phases per variable:
+     * - the saved phase: the polarity of the last assignment
+     * - the target phase: the polarity in the longest conflict free trail since the last rephase
+     * - the best phase: the polarity in the longest conflict free trail since the last best rephase
+     *
+     * Rephasing periodically overwrites the saved phases according to Phases::Schedule.
+     */
+    class Phases {
+        static constexpr char Unset = 2;
+        std::vector<char> saved;
+        std::vector<char> target;
+        std::vector<char> best;
+        std::size_t targetSize = 0;
+        std::size_t bestSize = 0;
+        std::size_t numRephases = 0;
+        bool initial;
+    public:
+        /**
+         * @brief Ways to overwrite the saved phases
+         */
+        enum class Rephase {
+            Original, ///< initial phase for all variables
+            Inverted, ///< inverted initial phase for all variables
+            Best,     ///< best phases
+            Walk      ///< result of a local search started from the saved phases
+        };
+
+        /**
+         * Order in which rephasing methods are applied, repeated cyclically
+         */
+        static constexpr std::array Schedule{Rephase::Best, Rephase::Walk, Rephase::Original,
+                                             Rephase::Best, Rephase::Walk, Rephase::Inverted};
+
+        /**
+         * CTor
+         * @param numVariables number of variables
+         * @param initial initial phase of all variables, true for positive
+         */
+        explicit Phases(std::size_t numVariables, bool initial = true);
+
+        /**
+         * Gets the decision literal of a variable
+         * @param x variable
+         * @param useTarget whether to prefer the target phase over the saved phase
+         * @return literal of x
+         */
+        Literal decide(Variable x, bool useTarget) const;
+
+        /**
+         * Saves the phase of an assigned literal
+         * @param l
+         */
+        void save(Literal l) {
+            saved[var(l).get()] = l.sign() > 0;
+        }
+
+        /**
+         * Updates the target and best phases if the given conflict free trail is longer than the trails they were taken
+         * from
+         * @param trail conflict free trail
+         */
+        void update(std::span<const Literal> trail);
+
+        /**
+         * Gets the next rephasing method and advances the schedule
+         * @return
+         */
+        Rephase nextRephase();
+
+        /**
+         * Overwrites the saved phases with the given method. Rephase::Walk needs to be done by the caller using
+         * the saved phases and sat::walk. Resets the target phases.
+         * @param method Rephase::Original, Rephase::Inverted or Rephase::Best
+         */
+        void rephase(Rephase method);
+
+        /**
+         * Gets the saved phases, indexed by variable, 1 for positive, 0 for negative
+         * @return
+         */
+        std::vector<char> &getSaved();
+
+        /**
+         * Number of rephases so far
+         * @return
+         */
+        std::size_t getNumRephases() const;
+    };
+
+    /**
+     * Local search for an assignment that satisfies as many clauses as possible (WalkSAT). Starts from the given
+     * phases and flips variables of random unsatisfied clauses, preferring flips that break the fewest clauses.
+     * @param clauses clauses without assigned literals
+     * @param phases in: initial assignment, out: best assignment found. Indexed by variable, 1 for positive, 0 for
+     * negative
+     * @param maxFlips maximum number of flips
+     * @param seed random seed
+     * @return number of clauses unsatisfied by the best assignment
+     */
+    std::size_t walk(const std::vector<std::vector<Literal>> &clauses, std::vector<char> &phases,
+                     std::size_t maxFlips, std::uint64_t seed = 0);
+}
+
+#endif //PHASES_HPP
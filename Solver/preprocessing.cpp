@@ -0,0 +1,260 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include <algorithm>
+#include <cassert>
+
+#include "preprocessing.hpp"
+
+namespace sat {
+
+    Preprocessor::Preprocessor(std::size_t numVariables) : occurrences(2 * numVariables),
+                                                           numOccurrences(2 * numVariables, 0),
+                                                           values(numVariables, TruthValue::Undefined),
+                                                           eliminated(numVariables, 0), marks(2 * numVariables, 0),
+                                                           candidates(numVariables) {}
+
+    bool Preprocessor::addClause(std::vector<Literal> clause) {
+        if (not ok) {
+            return false;
+        }
+
+        std::ranges::sort(clause, {}, [](Literal l) { return l.get(); });
+        const auto [first, last] = std::ranges::unique(clause);
+        clause.erase(first, last);
+        std::vector<Literal> literals;
+        literals.reserve(clause.size());
+        for (std::size_t i = 0; i < clause.size(); ++i) {
+            const auto value = values[var(clause[i]).get()];
+            // x and ¬x are adjacent after sorting
+            if (value == static_cast<TruthValue>(clause[i].sign()) ||
+                (i + 1 < clause.size() && clause[i + 1] == clause[i].negate())) {
+                return true;
+            }
+
+            if (value == TruthValue::Undefined) {
+                literals.emplace_back(clause[i]);
+            }
+        }
+
+        if (literals.empty()) {
+            ok = false;
+        } else if (literals.size() == 1) {
+            assign(literals.front());
+        } else {
+            attach(std::move(literals));
+        }
+
+        return ok;
+    }
+
+    bool Preprocessor::eliminate() {
+        if (not propagateUnits()) {
+            return false;
+        }
+
+        for (unsigned x = 0; x < values.size(); ++x) {
+            updateCandidate(x);
+        }
+
+        while (ok && not candidates.empty() && steps < StepLimit) {
+            const Variable x = candidates.pop();
+            if (values[x.get()] == TruthValue::Undefined && not eliminated[x.get()] && tryEliminate(x)) {
+                ++numEliminated;
+                propagateUnits();
+            }
+        }
+
+        return ok;
+    }
+
+    std::vector<std::vector<Literal>> Preprocessor::getClauses() const {
+        std::vector<std::vector<Literal>> result;
+        for (std::uint32_t c = 0; c < clauses.size(); ++c) {
+            if (not removed[c]) {
+                result.emplace_back(clauses[c]);
+            }
+        }
+
+        for (unsigned x = 0; x < values.size(); ++x) {
+            if (values[x] != TruthValue::Undefined) {
+                result.push_back({values[x] == TruthValue::True ? pos(x) : neg(x)});
+            }
+        }
+
+        return result;
+    }
+
+    const ReconstructionStack &Preprocessor::getReconstructionStack() const {
+        return reconstruction;
+    }
+
+    std::size_t Preprocessor::getNumEliminated() const {
+        return numEliminated;
+    }
+
+    void Preprocessor::assign(Literal l) {
+        auto &value = values[var(l).get()];
+        if (value == TruthValue::Undefined) {
+            value = static_cast<TruthValue>(l.sign());
+            unitQueue.emplace_back(l);
+        } else if (value != static_cast<TruthValue>(l.sign())) {
+            ok = false;
+        }
+    }
+
+    bool Preprocessor::propagateUnits() {
+        while (ok && not unitQueue.empty()) {
+            const auto l = unitQueue.back();
+            unitQueue.pop_back();
+            for (auto c : occurrences[l.get()]) {
+                if (not removed[c]) {
+                    remove(c);
+                }
+            }
+
+            occurrences[l.get()].clear();
+            const auto falsified = l.negate();
+            auto occurrencesOfFalsified = std::move(occurrences[falsified.get()]);
+            occurrences[falsified.get()].clear();
+            for (auto c : occurrencesOfFalsified) {
+                if (removed[c]) {
+                    continue;
+                }
+
+                auto &clause = clauses[c];
+                std::erase(clause, falsified);
+                --numOccurrences[falsified.get()];
+                if (clause.size() == 1) {
+                    assign(clause.front());
+                    remove(c);
+                } else if (clause.empty()) {
+                    ok = false;
+                }
+            }
+        }
+
+        return ok;
+    }
+
+    void Preprocessor::attach(std::vector<Literal> clause) {
+        const auto c = static_cast<std::uint32_t>(clauses.size());
+        for (auto l : clause) {
+            occurrences[l.get()].emplace_back(c);
+            ++numOccurrences[l.get()];
+            updateCandidate(var(l));
+        }
+
+        clauses.emplace_back(std::move(clause));
+        removed.emplace_back(0);
+    }
+
+    void Preprocessor::remove(std::uint32_t c) {
+        assert(not removed[c]);
+        removed[c] = 1;
+        for (auto l : clauses[c]) {
+            --numOccurrences[l.get()];
+            updateCandidate(var(l));
+        }
+    }
+
+    void Preprocessor::updateCandidate(Variable x) {
+        if (eliminated[x.get()] || values[x.get()] != TruthValue::Undefined) {
+            return;
+        }
+
+        const auto cost = std::int64_t(numOccurrences[pos(x).get()]) * numOccurrences[neg(x).get()];
+        candidates.setKey(x.get(), -cost);
+        candidates.push(x.get());
+    }
+
+    const std::vector<std::uint32_t> &Preprocessor::liveOccurrences(Literal l) {
+        auto &list = occurrences[l.get()];
+        std::erase_if(list, [this](auto c) { return removed[c] != 0; });
+        return list;
+    }
+
+    bool Preprocessor::tryEliminate(Variable x) {
+        if (numOccurrences[pos(x).get()] > MaxOccurrences || numOccurrences[neg(x).get()] > MaxOccurrences ||
+            numOccurrences[pos(x).get()] + numOccurrences[neg(x).get()] == 0) {
+            return false;
+        }
+
+        const auto positive = liveOccurrences(pos(x));
+        const auto negative = liveOccurrences(neg(x));
+        const auto bound = positive.size() + negative.size();
+        resolvents.clear();
+        std::vector<Literal> resolvent;
+        for (auto c : positive) {
+            for (auto d : negative) {
+                steps += clauses[c].size() + clauses[d].size();
+                if (not resolve(clauses[c], clauses[d], pos(x), resolvent)) {
+                    continue;
+                }
+
+                if (resolvents.size() == bound || resolvent.size() > MaxResolventLength) {
+                    return false;
+                }
+
+                resolvents.emplace_back(resolvent);
+            }
+        }
+
+        for (auto c : positive) {
+            reconstruction.push(pos(x), clauses[c]);
+            remove(c);
+        }
+
+        for (auto d : negative) {
+            reconstruction.push(neg(x), clauses[d]);
+            remove(d);
+        }
+
+        eliminated[x.get()] = 1;
+        occurrences[pos(x).get()].clear();
+        occurrences[neg(x).get()].clear();
+        for (auto &r : resolvents) {
+            assert(not r.empty());
+            if (r.size() == 1) {
+                assign(r.front());
+            } else {
+                attach(std::move(r));
+            }
+        }
+
+        return true;
+    }
+
+    bool Preprocessor::resolve(const std::vector<Literal> &c, const std::vector<Literal> &d, Literal pivot,
+                               std::vector<Literal> &resolvent) {
+        resolvent.clear();
+        for (auto l : c) {
+            if (l != pivot) {
+                marks[l.get()] = 1;
+                resolvent.emplace_back(l);
+            }
+        }
+
+        bool tautology = false;
+        for (auto l : d) {
+            if (l == pivot.negate() || marks[l.get()]) {
+                continue;
+            }
+
+            if (marks[l.negate().get()]) {
+                tautology = true;
+                break;
+            }
+
+            resolvent.emplace_back(l);
+        }
+
+        for (auto l : c) {
+            marks[l.get()] = 0;
+        }
+
+        return not tautology;
+    }
+}
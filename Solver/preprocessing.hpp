@@ -0,0 +1,129 @@
+/**
+* @date 17.10.26
+* @file preprocessing.hpp
+* @brief Contains the preprocessor that simplifies a formula before it is added to the solver
+*/
+
+#ifndef PREPROCESSING_HPP
+#define PREPROCESSING_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "basic_structures.hpp"
+#include "reconstruction.hpp"
+#include "util/IndexedHeap.hpp"
+
+namespace sat {
+
+    /**
+     * @brief SatELite style bounded variable elimination.
+     * @details @copybrief
+     * A variable x is eliminated by replacing all clauses containing x or ¬x by their non-tautological resolvents on
+     * x. This is only done if the number of resolvents does not exceed the number of removed clauses and no
+     * resolvent is longer than MaxResolventLength. Candidates are processed in the order of their occurrence cost
+     * |occ(x)| * |occ(¬x)|, variables whose occurrences change are queued again. Unit clauses are propagated. The
+     * removed clauses are recorded on a reconstruction stack that extends models of the simplified formula.
+     *
+     * Usage: add all clauses, call eliminate(), add getClauses() to the solver and extend its model with
+     * getReconstructionStack().
+     */
+    class Preprocessor {
+        std::vector<std::vector<Literal>> clauses;
+        std::vector<char> removed;
+        // indexed by literal id, may contain removed clauses
+        std::vector<std::vector<std::uint32_t>> occurrences;
+        // indexed by literal id, number of clauses containing the literal
+        std::vector<std::uint32_t> numOccurrences;
+        std::vector<TruthValue> values;
+        std::vector<Literal> unitQueue;
+        std::vector<char> eliminated;
+        // indexed by literal id, used to build resolvents
+        std::vector<char> marks;
+        // candidates ordered by negated occurrence cost
+        IndexedHeap<std::int64_t> candidates;
+        ReconstructionStack reconstruction;
+        std::vector<std::vector<Literal>> resolvents;
+        std::size_t numEliminated = 0;
+        std::size_t steps = 0;
+        bool ok = true;
+    public:
+        /// resolvents with more literals prevent the elimination
+        static constexpr std::size_t MaxResolventLength = 20;
+        /// variables with more occurrences of one of their literals are not eliminated
+        static constexpr std::size_t MaxOccurrences = 100;
+        /// budget of literals visited during resolution
+        static constexpr std::size_t StepLimit = 50'000'000;
+
+        /**
+         * CTor
+         * @param numVariables number of variables
+         */
+        explicit Preprocessor(std::size_t numVariables);
+
+        /**
+         * Adds a clause. Duplicate literals are removed, tautologies are ignored. Must not be called after eliminate
+         * @param clause
+         * @return false if the formula is unsatisfiable, true otherwise
+         */
+        bool addClause(std::vector<Literal> clause);
+
+        /**
+         * Propagates unit clauses and eliminates variables
+         * @return false if the formula is unsatisfiable, true otherwise
+         */
+        bool eliminate();
+
+        /**
+         * Gets the simplified formula including a unit clause for every fixed variable
+         * @return clauses
+         */
+        std::vector<std::vector<Literal>> getClauses() const;
+
+        /**
+         * Gets the stack that extends models of the simplified formula to models of the original formula
+         * @return
+         */
+        const ReconstructionStack &getReconstructionStack() const;
+
+        /**
+         * Number of eliminated variables
+         * @return
+         */
+        std::size_t getNumEliminated() const;
+
+    private:
+        void assign(Literal l);
+
+        bool propagateUnits();
+
+        void attach(std::vector<Literal> clause);
+
+        void remove(std::uint32_t c);
+
+        void updateCandidate(Variable x);
+
+        /**
+         * Collects the clauses containing l that are not removed and drops removed ones from the occurrence list
+         * @param l
+         * @return clause indices
+         */
+        const std::vector<std::uint32_t> &liveOccurrences(Literal l);
+
+        bool tryEliminate(Variable x);
+
+        /**
+         * Computes the resolvent of two clauses
+         * @param c clause containing pivot
+         * @param d clause containing ¬pivot
+         * @param pivot
+         * @param resolvent out parameter
+         * @return false if the resolvent is a tautology, true otherwise
+         */
+        bool resolve(const std::vector<Literal> &c, const std::vector<Literal> &d, Literal pivot,
+                     std::vector<Literal> &resolvent);
+    };
+}
+
+#endif //PREPROCESSING_HPP
@@ -0,0 +1,61 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include <algorithm>
+#include <cassert>
+
+#include "reconstruction.hpp"
+
+namespace sat {
+
+    void ReconstructionStack::push(Literal witness, std::span<const Literal> clause) {
+        assert(std::ranges::find(clause, witness) != clause.end());
+        entries.emplace_back(literals.size(), witness);
+        literals.insert(literals.end(), clause.begin(), clause.end());
+    }
+
+    void ReconstructionStack::extend(std::vector<TruthValue> &model) const {
+        const auto isTrue = [&model](Literal l) {
+            return model[var(l).get()] == static_cast<TruthValue>(l.sign());
+        };
+
+        auto end = literals.size();
+        for (auto it = entries.rbegin(); it != entries.rend(); ++it) {
+            const auto [start, witness] = *it;
+            const auto clause = std::span(literals).subspan(start, end - start);
+            end = start;
+            if (std::ranges::none_of(clause, isTrue)) {
+                model[var(witness).get()] = static_cast<TruthValue>(witness.sign());
+            }
+        }
+    }
+
+    std::vector<Literal> ReconstructionStack::extend(const std::vector<Literal> &model,
+                                                     std::size_t numVariables) const {
+        std::vector values(numVariables, TruthValue::Undefined);
+        for (auto l : model) {
+            values[var(l).get()] = static_cast<TruthValue>(l.sign());
+        }
+
+        extend(values);
+        std::vector<Literal> result;
+        result.reserve(numVariables);
+        for (unsigned x = 0; x < numVariables; ++x) {
+            if (values[x] != TruthValue::Undefined) {
+                result.emplace_back(values[x] == TruthValue::True ? pos(x) : neg(x));
+            }
+        }
+
+        return result;
+    }
+
+    std::size_t ReconstructionStack::size() const noexcept {
+        return entries.size();
+    }
+
+    bool ReconstructionStack::empty() const noexcept {
+        return entries.empty();
+    }
+}
@@ -0,0 +1,62 @@
+/**
+* @date 17.10.26
+* @file reconstruction.hpp
+* @brief Contains the reconstruction stack that extends models of simplified formulas
+*/
+
+#ifndef RECONSTRUCTION_HPP
+#define RECONSTRUCTION_HPP
+
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "basic_structures.hpp"
+
+namespace sat {
+
+    /**
+     * @brief Records clauses removed by simplifications that do not preserve models.
+     * @details @copybrief
+     * Each entry is a removed clause together with a witness literal of the clause. A model of the simplified formula
+     * is extended to a model of the original formula by going through the entries in reverse order and setting the
+     * witness of every clause that is not satisfied to true.
+     */
+    class ReconstructionStack {
+        std::vector<Literal> literals;
+        // start of each clause in literals and its witness
+        std::vector<std::pair<std::size_t, Literal>> entries;
+    public:
+        /**
+         * Records a removed clause
+         * @param witness literal of the clause that is set to true if the clause is not satisfied
+         * @param clause removed clause
+         */
+        void push(Literal witness, std::span<const Literal> clause);
+
+        /**
+         * Extends a model of the simplified formula
+         * @param model values indexed by variable. Variables that are not contained must not occur on the stack
+         */
+        void extend(std::vector<TruthValue> &model) const;
+
+        /**
+         * Extends a model of the simplified formula
+         * @param model assigned literals of the simplified formula
+         * @param numVariables number of variables of the original formula
+         * @return model of the original formula
+         */
+        std::vector<Literal> extend(const std::vector<Literal> &model, std::size_t numVariables) const;
+
+        /**
+         * Number of recorded clauses
+         * @return
+         */
+        std::size_t size() const noexcept;
+
+        bool empty() const noexcept;
+    };
+}
+
+#endif //RECONSTRUCTION_HPP
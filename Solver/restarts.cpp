@@ -0,0 +1,116 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include <array>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include "restarts.hpp"
+
+namespace sat {
+
+    std::uint64_t luby(std::uint64_t i) {
+        // find the complete subsequence containing i and its size 2^(seq + 1) - 1
+        std::uint64_t size = 1;
+        unsigned seq = 0;
+        while (size < i + 1) {
+            ++seq;
+            size = 2 * size + 1;
+        }
+
+        while (size - 1 != i) {
+            size = (size - 1) / 2;
+            --seq;
+            i = i % size;
+        }
+
+        return std::uint64_t(1) << seq;
+    }
+
+    void ExponentialMovingAverage::update(double value) noexcept {
+        biased += alpha * (value - biased);
+        decayed *= 1 - alpha;
+    }
+
+    double ExponentialMovingAverage::get() const noexcept {
+        return decayed < 1 ? biased / (1 - decayed) : 0;
+    }
+
+    LubyRestarts::LubyRestarts(std::uint64_t unit) : unit(unit) {}
+
+    void LubyRestarts::onConflict(unsigned, std::size_t) {
+        ++conflicts;
+    }
+
+    bool LubyRestarts::shouldRestart() const {
+        return conflicts >= unit * luby(numRestarts);
+    }
+
+    void LubyRestarts::onRestart() {
+        ++numRestarts;
+        conflicts = 0;
+    }
+
+    GeometricRestarts::GeometricRestarts(double first, double factor) : interval(first), factor(factor) {}
+
+    void GeometricRestarts::onConflict(unsigned, std::size_t) {
+        ++conflicts;
+    }
+
+    bool GeometricRestarts::shouldRestart() const {
+        return static_cast<double>(conflicts) >= interval;
+    }
+
+    void GeometricRestarts::onRestart() {
+        interval *= factor;
+        conflicts = 0;
+    }
+
+    void GlucoseRestarts::onConflict(unsigned lbd, std::size_t trailSize) {
+        ++conflicts;
+        ++conflictsSinceRestart;
+        const auto size = static_cast<double>(trailSize);
+        if (conflicts > BlockingStart && conflictsSinceRestart >= MinInterval &&
+            size > BlockingFactor * trailSizes.get()) {
+            conflictsSinceRestart = 0;
+            ++numBlocked;
+        }
+
+        trailSizes.update(size);
+        fastLbd.update(lbd);
+        slowLbd.update(lbd);
+    }
+
+    bool GlucoseRestarts::shouldRestart() const {
+        return conflictsSinceRestart >= MinInterval && fastLbd.get() > Margin * slowLbd.get();
+    }
+
+    void GlucoseRestarts::onRestart() {
+        conflictsSinceRestart = 0;
+    }
+
+    std::uint64_t GlucoseRestarts::getNumBlocked() const {
+        return numBlocked;
+    }
+
+    AnyRestartPolicy makeRestartPolicy(const std::string &name) {
+        using Factory = AnyRestartPolicy (*)();
+        static constexpr std::array<std::pair<std::string_view, Factory>, 4> factories{{
+            {"glucose", []() -> AnyRestartPolicy { return GlucoseRestarts(); }},
+            {"luby", []() -> AnyRestartPolicy { return LubyRestarts(); }},
+            {"geometric", []() -> AnyRestartPolicy { return GeometricRestarts(); }},
+            {"none", []() -> AnyRestartPolicy { return NoRestarts(); }}
+        }};
+
+        for (const auto &[factoryName, factory] : factories) {
+            if (factoryName == name) {
+                return factory();
+            }
+        }
+
+        throw std::invalid_argument("Unknown restart policy " + name);
+    }
+}
@@ -0,0 +1,172 @@
+/**
+* @date 17.10.26
+* @file restarts.hpp
+* @brief Contains restart policies for the CDCL search
+*/
+
+#ifndef RESTARTS_HPP
+#define RESTARTS_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <variant>
+
+namespace sat {
+    /**
+     * Concept modelling the restart policy interface. A restart policy is informed about every conflict with the
+     * literal block distance of the learned clause and the trail size at the conflict. The search asks the policy
+     * before each decision whether it should restart and informs it about every restart.
+     */
+    template<typename P>
+    concept restart_policy = requires(P p, unsigned lbd, std::size_t trailSize) {
+        p.onConflict(lbd, trailSize);
+        { p.shouldRestart() } -> std::convertible_to<bool>;
+        p.onRestart();
+    };
+
+    /**
+     * Computes the i-th element of the Luby sequence 1, 1, 2, 1, 1, 2, 4, 1, 1, 2, 1, 1, 2, 4, 8, ...
+     * @param i zero based index
+     * @return element of the sequence
+     */
+    std::uint64_t luby(std::uint64_t i);
+
+    /**
+     * @brief Exponential moving average with bias correction.
+     * @details @copybrief
+     * The average is not biased towards zero in the beginning, the first value is returned exactly.
+     */
+    class ExponentialMovingAverage {
+        double alpha;
+        double biased = 0;
+        double decayed = 1;
+    public:
+        /**
+         * CTor
+         * @param alpha smoothing factor in (0, 1], larger values adapt faster
+         */
+        explicit constexpr ExponentialMovingAverage(double alpha) noexcept : alpha(alpha) {}
+
+        /**
+         * Adds a value to the average
+         * @param value
+         */
+        void update(double value) noexcept;
+
+        /**
+         * Current average, 0 if no value was added
+         * @return
+         */
+        double get() const noexcept;
+    };
+
+    /**
+     * @brief Never restarts
+     */
+    struct NoRestarts {
+        void onConflict(unsigned, std::size_t) const noexcept {}
+
+        bool shouldRestart() const noexcept {
+            return false;
+        }
+
+        void onRestart() const noexcept {}
+    };
+
+    /**
+     * @brief Restarts after a number of conflicts that follows the Luby sequence times a unit
+     */
+    class LubyRestarts {
+        std::uint64_t unit;
+        std::uint64_t numRestarts = 0;
+        std::uint64_t conflicts = 0;
+    public:
+        /**
+         * CTor
+         * @param unit number of conflicts corresponding to 1 in the Luby sequence
+         */
+        explicit LubyRestarts(std::uint64_t unit = 100);
+
+        void onConflict(unsigned, std::size_t);
+
+        bool shouldRestart() const;
+
+        void onRestart();
+    };
+
+    /**
+     * @brief Restarts after a number of conflicts that grows geometrically
+     */
+    class GeometricRestarts {
+        double interval;
+        double factor;
+        std::uint64_t conflicts = 0;
+    public:
+        /**
+         * CTor
+         * @param first number of conflicts before the first restart
+         * @param factor growth factor of the interval
+         */
+        explicit GeometricRestarts(double first = 100, double factor = 1.5);
+
+        void onConflict(unsigned, std::size_t);
+
+        bool shouldRestart() const;
+
+        void onRestart();
+    };
+
+    /**
+     * @brief Glucose style dynamic restarts.
+     * @details @copybrief
+     * Restarts when the recent learned clauses are worse than the average, which is the case when a fast moving average
+     * of their literal block distances exceeds a slow one by a margin. A restart is blocked when the trail at a
+     * conflict is much larger than on average, since the search is then likely close to a model.
+     */
+    class GlucoseRestarts {
+        ExponentialMovingAverage fastLbd{1.0 / 32};
+        ExponentialMovingAverage slowLbd{1e-5};
+        ExponentialMovingAverage trailSizes{1.0 / 5000};
+        std::uint64_t conflicts = 0;
+        std::uint64_t conflictsSinceRestart = 0;
+        std::uint64_t numBlocked = 0;
+    public:
+        /// fast average must exceed the slow average by this factor
+        static constexpr double Margin = 1.25;
+        /// minimum number of conflicts between two restarts
+        static constexpr std::uint64_t MinInterval = 50;
+        /// restarts are blocked when the trail exceeds its average by this factor
+        static constexpr double BlockingFactor = 1.4;
+        /// number of conflicts before restarts can be blocked
+        static constexpr std::uint64_t BlockingStart = 10000;
+
+        void onConflict(unsigned lbd, std::size_t trailSize);
+
+        bool shouldRestart() const;
+
+        void onRestart();
+
+        /**
+         * Number of blocked restarts
+         * @return
+         */
+        std::uint64_t getNumBlocked() const;
+    };
+
+    /**
+     * Any of the restart policies
+     */
+    using AnyRestartPolicy = std::variant<GlucoseRestarts, LubyRestarts, GeometricRestarts, NoRestarts>;
+
+    /**
+     * Creates a restart policy by name
+     * @param name one of "glucose", "luby", "geometric" or "none"
+     * @return restart policy with default parameters
+     * @throws std::invalid_argument if the name is unknown
+     */
+    AnyRestartPolicy makeRestartPolicy(const std::string &name);
+}
+
+#endif //RESTARTS_HPP
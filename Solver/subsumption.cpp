@@ -0,0 +1,149 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+#include "subsumption.hpp"
+
+namespace sat {
+
+    Subsumer::Subsumer(std::size_t numVariables) : occurrences(2 * numVariables), numOccurrences(2 * numVariables, 0) {}
+
+    std::uint32_t Subsumer::add(std::span<const Literal> literals, bool subsuming) {
+        assert(not literals.empty());
+        std::vector<Literal> sorted(literals.begin(), literals.end());
+        std::ranges::sort(sorted, {}, [](Literal l) { return l.get(); });
+        for (auto l : sorted) {
+            ++numOccurrences[l.get()];
+        }
+
+        const auto sig = signature(sorted);
+        entries.push_back({std::move(sorted), sig, subsuming});
+        return static_cast<std::uint32_t>(entries.size() - 1);
+    }
+
+    void Subsumer::run() {
+        std::vector<std::uint32_t> order(entries.size());
+        std::iota(order.begin(), order.end(), 0);
+        // smaller clauses first, so that every clause only needs to be compared with clauses processed before
+        std::ranges::stable_sort(order, {}, [this](auto index) { return entries[index].literals.size(); });
+        for (auto index : order) {
+            if (steps >= StepLimit) {
+                break;
+            }
+
+            if (not simplify(index) && entries[index].subsuming) {
+                connect(index);
+            }
+        }
+    }
+
+    auto Subsumer::getStatus(std::uint32_t index) const -> Status {
+        return entries[index].status;
+    }
+
+    std::span<const Literal> Subsumer::getLiterals(std::uint32_t index) const {
+        return entries[index].literals;
+    }
+
+    std::size_t Subsumer::size() const {
+        return entries.size();
+    }
+
+    std::size_t Subsumer::getNumSubsumed() const {
+        return numSubsumed;
+    }
+
+    std::size_t Subsumer::getNumStrengthened() const {
+        return numStrengthened;
+    }
+
+    bool Subsumer::subsumes(const Entry &c, const Entry &d, std::optional<Literal> &strengthen) {
+        // literals are sorted by id, so x and ¬x are neighbours and both clauses are ordered by variable
+        std::size_t j = 0;
+        const auto &literals = d.literals;
+        for (auto l : c.literals) {
+            while (j < literals.size() && var(literals[j]).get() < var(l).get()) {
+                ++j;
+            }
+
+            steps += j + 1;
+            if (j == literals.size() || var(literals[j]) != var(l)) {
+                return false;
+            }
+
+            if (literals[j] != l) {
+                if (strengthen) {
+                    return false;
+                }
+
+                strengthen = literals[j];
+            }
+
+            ++j;
+        }
+
+        return true;
+    }
+
+    bool Subsumer::simplify(std::uint32_t index) {
+        auto &entry = entries[index];
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (std::size_t k = 0; k < entry.literals.size() && not changed; ++k) {
+                for (auto l : {entry.literals[k], entry.literals[k].negate()}) {
+                    for (auto other : occurrences[l.get()]) {
+                        const auto &candidate = entries[other];
+                        if (candidate.literals.size() > entry.literals.size() ||
+                            (candidate.signature & ~entry.signature) != 0) {
+                            continue;
+                        }
+
+                        std::optional<Literal> strengthen;
+                        if (not subsumes(candidate, entry, strengthen)) {
+                            continue;
+                        }
+
+                        if (not strengthen) {
+                            entry.status = Status::Subsumed;
+                            ++numSubsumed;
+                            return true;
+                        }
+
+                        // removing the last literal would derive the empty clause, which the caller detects anyway
+                        if (entry.literals.size() == 1) {
+                            continue;
+                        }
+
+                        std::erase(entry.literals, *strengthen);
+                        entry.signature = signature(entry.literals);
+                        if (entry.status != Status::Strengthened) {
+                            entry.status = Status::Strengthened;
+                            ++numStrengthened;
+                        }
+
+                        changed = true;
+                        break;
+                    }
+
+                    if (changed) {
+                        break;
+                    }
+                }
+            }
+        }
+
+        return false;
+    }
+
+    void Subsumer::connect(std::uint32_t index) {
+        const auto &literals = entries[index].literals;
+        const auto least = std::ranges::min(literals, {}, [this](Literal l) { return numOccurrences[l.get()]; });
+        occurrences[least.get()].emplace_back(index);
+    }
+}
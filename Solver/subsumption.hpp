@@ -0,0 +1,147 @@
+/**
+* @date 17.10.26
+* @file subsumption.hpp
+* @brief Contains the subsumption and self-subsuming resolution engine
+*/
+
+#ifndef SUBSUMPTION_HPP
+#define SUBSUMPTION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "basic_structures.hpp"
+
+namespace sat {
+
+    /**
+     * Signature of a clause: one bit out of 64 per variable of the clause. If the variables of c are a subset of the
+     * variables of d, then (signature(c) & ~signature(d)) == 0. Variables instead of literals are used so that the
+     * same filter applies to self-subsuming resolution
+     * @param literals
+     * @return
+     */
+    constexpr std::uint64_t signature(std::span<const Literal> literals) noexcept {
+        std::uint64_t result = 0;
+        for (auto l : literals) {
+            result |= std::uint64_t(1) << (var(l).get() & 63);
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Removes subsumed clauses and strengthens clauses by self-subsuming resolution.
+     * @details @copybrief
+     * A clause c subsumes a clause d if c ⊆ d, then d is redundant. If c = c' ∨ x and d = d' ∨ ¬x with c' ⊆ d', the
+     * resolvent d' subsumes d, so ¬x can be removed from d (self-subsuming resolution).
+     *
+     * Clauses are copied with sorted literals. They are processed in the order of their size and compared only with
+     * smaller or equally large clauses processed before. Every processed clause that may subsume others is stored in
+     * the occurrence list of its literal with the fewest occurrences (one-watch scheme), so a candidate subsuming
+     * clause d of c is found in the occurrence list of some literal of c or its negation. Candidates are filtered by
+     * their signatures before the literals are compared by a merge of the sorted clauses. Strengthened clauses are
+     * checked again.
+     *
+     * Usage: add all clauses, call run() and apply getStatus() and getLiterals() to the original clauses.
+     */
+    class Subsumer {
+    public:
+        /**
+         * @brief Result for an added clause
+         */
+        enum class Status {
+            Kept,         ///< clause is unchanged
+            Subsumed,     ///< clause is subsumed by another clause and can be removed
+            Strengthened  ///< literals were removed from the clause, see getLiterals
+        };
+
+    private:
+        struct Entry {
+            std::vector<Literal> literals;
+            std::uint64_t signature;
+            bool subsuming;
+            Status status = Status::Kept;
+        };
+
+        std::vector<Entry> entries;
+        // indexed by literal id, entries that may subsume others, keyed on their least occurring literal
+        std::vector<std::vector<std::uint32_t>> occurrences;
+        // indexed by literal id, number of added clauses containing the literal
+        std::vector<std::uint32_t> numOccurrences;
+        std::size_t numSubsumed = 0;
+        std::size_t numStrengthened = 0;
+        std::size_t steps = 0;
+    public:
+        /// budget of literals visited during the comparison of clauses
+        static constexpr std::size_t StepLimit = 20'000'000;
+
+        /**
+         * CTor
+         * @param numVariables number of variables
+         */
+        explicit Subsumer(std::size_t numVariables);
+
+        /**
+         * Adds a clause
+         * @param literals literals of the clause, must not contain duplicates or complementary literals
+         * @param subsuming whether the clause may subsume or strengthen others. Redundant clauses (e.g. learned
+         * clauses) can be added as non subsuming clauses, then only they are simplified
+         * @return index of the clause
+         */
+        std::uint32_t add(std::span<const Literal> literals, bool subsuming = true);
+
+        /**
+         * Removes subsumed clauses and strengthens clauses until the step limit is reached
+         */
+        void run();
+
+        /**
+         * Result for an added clause
+         * @param index index returned by add
+         * @return
+         */
+        Status getStatus(std::uint32_t index) const;
+
+        /**
+         * Literals of an added clause after strengthening, sorted by literal id. Strengthening stops at unit clauses
+         * @param index index returned by add
+         * @return
+         */
+        std::span<const Literal> getLiterals(std::uint32_t index) const;
+
+        /**
+         * Number of added clauses
+         * @return
+         */
+        std::size_t size() const;
+
+        std::size_t getNumSubsumed() const;
+
+        std::size_t getNumStrengthened() const;
+
+    private:
+        /**
+         * Compares two clauses
+         * @param c candidate subsuming clause
+         * @param d clause that is at least as large as c
+         * @param strengthen out parameter, receives the literal of d that is removed by self-subsuming resolution
+         * @return true if c subsumes d or strengthens d, false otherwise
+         */
+        bool subsumes(const Entry &c, const Entry &d, std::optional<Literal> &strengthen);
+
+        /**
+         * Searches a clause that subsumes or strengthens the given clause among the connected clauses
+         * @param index clause index
+         * @return true if the clause was subsumed, false otherwise
+         */
+        bool simplify(std::uint32_t index);
+
+        void connect(std::uint32_t index);
+    };
+}
+
+#endif //SUBSUMPTION_HPP
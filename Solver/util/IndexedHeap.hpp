@@ -0,0 +1,195 @@
+/**
+* @date 17.10.26
+* @file IndexedHeap.hpp
+* @brief Contains a binary max heap over integer ids with updatable keys
+*/
+
+#ifndef INDEXEDHEAP_HPP
+#define INDEXEDHEAP_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace sat {
+
+    /**
+     * @brief Binary max heap containing a subset of the ids 0, ..., n - 1.
+     * @details @copybrief
+     * Every id has a key, also when it is not contained in the heap. The position of each id in the heap is stored,
+     * so membership tests are O(1) and changing the key of a contained id is O(log n).
+     * @tparam Key key type, must be totally ordered
+     */
+    template<typename Key>
+    class IndexedHeap {
+        static constexpr std::size_t NotContained = std::numeric_limits<std::size_t>::max();
+        std::vector<unsigned> heap;
+        std::vector<std::size_t> positions;
+        std::vector<Key> keys;
+    public:
+        /**
+         * CTor. Creates an empty heap
+         * @param numIds number of ids
+         * @param initialKey key of all ids
+         */
+        explicit IndexedHeap(std::size_t numIds = 0, Key initialKey = {}) : positions(numIds, NotContained),
+                                                                             keys(numIds, initialKey) {
+            heap.reserve(numIds);
+        }
+
+        /**
+         * Number of ids in the heap
+         * @return
+         */
+        std::size_t size() const noexcept {
+            return heap.size();
+        }
+
+        /**
+         * Whether the heap is empty
+         * @return
+         */
+        bool empty() const noexcept {
+            return heap.empty();
+        }
+
+        /**
+         * Whether the given id is in the heap
+         * @param id
+         * @return
+         */
+        bool contains(unsigned id) const noexcept {
+            return positions[id] != NotContained;
+        }
+
+        /**
+         * Id with the largest key
+         * @return
+         * @note heap must not be empty
+         */
+        unsigned top() const noexcept {
+            assert(not empty());
+            return heap.front();
+        }
+
+        /**
+         * Gets the key of an id
+         * @param id
+         * @return
+         */
+        const Key &key(unsigned id) const noexcept {
+            return keys[id];
+        }
+
+        /**
+         * Gets the keys of all ids
+         * @return vector indexed by id
+         */
+        const std::vector<Key> &getKeys() const noexcept {
+            return keys;
+        }
+
+        /**
+         * Changes the key of an id and restores the heap property if the id is contained in the heap
+         * @param id
+         * @param key new key
+         */
+        void setKey(unsigned id, Key key) {
+            const bool increased = keys[id] < key;
+            keys[id] = std::move(key);
+            if (contains(id)) {
+                if (increased) {
+                    siftUp(positions[id]);
+                } else {
+                    siftDown(positions[id]);
+                }
+            }
+        }
+
+        /**
+         * Multiplies all keys with a factor. Does not change the order of the ids
+         * @param factor positive factor
+         */
+        void scaleKeys(Key factor) {
+            for (auto &key : keys) {
+                key *= factor;
+            }
+        }
+
+        /**
+         * Inserts an id. Does nothing if the id is already contained
+         * @param id
+         */
+        void push(unsigned id) {
+            if (contains(id)) {
+                return;
+            }
+
+            positions[id] = heap.size();
+            heap.push_back(id);
+            siftUp(heap.size() - 1);
+        }
+
+        /**
+         * Removes the id with the largest key
+         * @return removed id
+         * @note heap must not be empty
+         */
+        unsigned pop() {
+            assert(not empty());
+            const auto res = heap.front();
+            positions[res] = NotContained;
+            heap.front() = heap.back();
+            heap.pop_back();
+            if (not heap.empty()) {
+                positions[heap.front()] = 0;
+                siftDown(0);
+            }
+
+            return res;
+        }
+
+    private:
+        void siftUp(std::size_t pos) {
+            const auto id = heap[pos];
+            while (pos > 0) {
+                const auto parent = (pos - 1) / 2;
+                if (not (keys[heap[parent]] < keys[id])) {
+                    break;
+                }
+
+                heap[pos] = heap[parent];
+                positions[heap[pos]] = pos;
+                pos = parent;
+            }
+
+            heap[pos] = id;
+            positions[id] = pos;
+        }
+
+        void siftDown(std::size_t pos) {
+            const auto id = heap[pos];
+            while (2 * pos + 1 < heap.size()) {
+                auto child = 2 * pos + 1;
+                if (child + 1 < heap.size() && keys[heap[child]] < keys[heap[child + 1]]) {
+                    ++child;
+                }
+
+                if (not (keys[id] < keys[heap[child]])) {
+                    break;
+                }
+
+                heap[pos] = heap[child];
+                positions[heap[pos]] = pos;
+                pos = child;
+            }
+
+            heap[pos] = id;
+            positions[id] = pos;
+        }
+    };
+}
+
+#endif //INDEXEDHEAP_HPP
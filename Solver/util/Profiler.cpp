@@ -39,4 +39,24 @@ namespace sat {
     void Profiler::addEvent(detail::TP start, detail::TP end, const std::string &name) {
         events[name].emplace_back(start, end);
     }
+
+    void Profiler::count(const std::string &name, std::size_t amount) {
+        counters[name] += amount;
+    }
+
+    std::size_t Profiler::getCount(const std::string &name) const {
+        auto res = counters.find(name);
+        return res == counters.end() ? 0 : res->second;
+    }
+
+    void Profiler::printCounts(std::ostream &os) const {
+        int nameWidth = 0;
+        for (const auto &[name, _] : counters) {
+            nameWidth = std::max(nameWidth, static_cast<int>(name.length()) + 1);
+        }
+
+        for (const auto &[name, value] : counters) {
+            os << "-- " << std::setw(nameWidth) << std::left << name << ": " << value << "\n";
+        }
+    }
 }
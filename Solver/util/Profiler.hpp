@@ -91,6 +91,7 @@ namespace sat {
      */
     class Profiler {
         std::unordered_map<std::string, std::vector<TimingEvent>> events;
+        std::unordered_map<std::string, std::size_t> counters;
 
     public:
 
@@ -180,6 +181,26 @@ namespace sat {
             return events.contains(event);
         }
 
+        /**
+         * Increments a counter
+         * @param name counter name
+         * @param amount value to add to the counter
+         */
+        void count(const std::string &name, std::size_t amount = 1);
+
+        /**
+         * gets the value of a counter
+         * @param name counter name
+         * @return counter value, 0 if the counter was never incremented
+         */
+        std::size_t getCount(const std::string &name) const;
+
+        /**
+         * prints all counters to an out stream
+         * @param os out stream
+         */
+        void printCounts(std::ostream &os) const;
+
         /**
          * prints all events to an out stream
          * @tparam T timing type
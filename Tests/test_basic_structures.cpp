@@ -37,6 +37,14 @@ TEST(structures, conversion_var_lit) {
     EXPECT_EQ(var(7), 3);
 }
 
+TEST(structures, constexpr_literals) {
+    using namespace sat;
+    static_assert(pos(3).negate() == neg(3));
+    static_assert(neg(3).sign() == -1 && pos(3).sign() == 1);
+    static_assert(var(neg(3)) == Variable(3));
+    static_assert(sizeof(TruthValue) == 1);
+}
+
 #ifndef __RUN_ALL_TESTS__
 
 int main(int argc, char **argv) {
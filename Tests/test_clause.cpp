@@ -10,6 +10,7 @@
 
 #include "util/concepts.hpp"
 #include "Clause.hpp"
+#include "clause_set.hpp"
 #include "testing_utils.hpp"
 
 
@@ -43,6 +44,24 @@ TEST(clause, equal_literals) {
     EXPECT_FALSE(c2.sameLiterals(c3));
 }
 
+TEST(clause, clause_set) {
+    using namespace sat;
+    const std::vector<Literal> lits{3, 1, 4, 2};
+    const std::vector<Literal> permuted{2, 4, 1, 3};
+    EXPECT_EQ(clauseHash(lits), clauseHash(permuted)) << "hash must not depend on the literal order";
+    ClauseSet set;
+    EXPECT_TRUE(set.insert(lits));
+    EXPECT_FALSE(set.insert(permuted));
+    EXPECT_TRUE(set.contains(permuted));
+    EXPECT_FALSE(set.contains(std::vector<Literal>{3, 1, 4}));
+    EXPECT_TRUE(set.insert(std::vector<Literal>{3, 1, 4}));
+    EXPECT_TRUE(set.insert(std::vector<Literal>{3, 1, 4, 5}));
+    EXPECT_FALSE(set.insertSorted(std::vector<Literal>{1, 2, 3, 4}));
+    EXPECT_TRUE(set.insertSorted(std::vector<Literal>{1, 2, 5}));
+    EXPECT_TRUE(set.contains(std::vector<Literal>{5, 1, 2}));
+    EXPECT_EQ(set.size(), 4);
+}
+
 TEST(clause, watchers) {
     using namespace sat;
     Clause c({5, 2, 3, 4, 1});
@@ -0,0 +1,107 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <vector>
+
+#include "ClauseArena.hpp"
+#include "testing_utils.hpp"
+
+TEST(clause_arena, alloc) {
+    using namespace sat;
+    ClauseArena arena;
+    std::vector<Literal> lits1{2, 5, 3};
+    std::vector<Literal> lits2{7, 1};
+    const auto r1 = arena.alloc(lits1);
+    const auto r2 = arena.alloc(Clause(lits2), true);
+    EXPECT_NE(r1, r2);
+    EXPECT_EQ(arena[r1].size(), 3);
+    EXPECT_EQ(arena[r2].size(), 2);
+    EXPECT_TRUE(test::setsEqual(arena[r1], test::LitSet(lits1.begin(), lits1.end())));
+    EXPECT_TRUE(test::setsEqual(arena[r2], test::LitSet(lits2.begin(), lits2.end())));
+    EXPECT_FALSE(arena[r1].isLearnt());
+    EXPECT_TRUE(arena[r2].isLearnt());
+}
+
+TEST(clause_arena, header) {
+    using namespace sat;
+    ClauseArena arena;
+    const auto ref = arena.alloc(std::vector<Literal>{2, 5, 3, 8}, true);
+    auto c = arena[ref];
+    c.setLbd(3);
+    c.setActivity(1.5f);
+    EXPECT_EQ(c.getLbd(), 3);
+    EXPECT_FLOAT_EQ(c.getActivity(), 1.5f);
+    EXPECT_TRUE(c.isLearnt());
+    EXPECT_FALSE(c.isUsed());
+    c.setUsed(true);
+    EXPECT_TRUE(c.isUsed());
+    EXPECT_EQ(c.getLbd(), 3) << "flags must not overwrite the literal block distance";
+    c.setUsed(false);
+    EXPECT_FALSE(c.isUsed());
+    EXPECT_TRUE(c.isLearnt());
+    EXPECT_EQ(c.size(), 4);
+    EXPECT_EQ(c[3], 8);
+}
+
+TEST(clause_arena, watchers) {
+    using namespace sat;
+    ClauseArena arena;
+    const auto ref = arena.alloc(std::vector<Literal>{5, 2, 3, 4, 1});
+    auto c = arena[ref];
+    EXPECT_EQ(c.getWatcherByRank(0), 5);
+    EXPECT_EQ(c.getWatcherByRank(1), 2);
+    c.swap(0, 3);
+    EXPECT_EQ(c.getRank(4), 0);
+    EXPECT_EQ(c.getRank(2), 1);
+    EXPECT_EQ(c.getRank(5), -1);
+    EXPECT_EQ(c[3], 5);
+    EXPECT_EQ(c.getSearchPos(), 2);
+    c.setSearchPos(4);
+    EXPECT_EQ(c.getSearchPos(), 4);
+}
+
+TEST(clause_arena, free_relocate) {
+    using namespace sat;
+    ClauseArena arena;
+    const auto r1 = arena.alloc(std::vector<Literal>{2, 5, 3});
+    const auto r2 = arena.alloc(std::vector<Literal>{7, 1});
+    EXPECT_EQ(arena.wasted(), 0);
+    arena.free(r1);
+    EXPECT_TRUE(arena[r1].isDeleted());
+    EXPECT_FALSE(arena[r2].isDeleted());
+    EXPECT_EQ(arena.wasted(), r2 - r1);
+    ClauseArena to;
+    const auto newRef = arena.relocate(r2, to);
+    EXPECT_EQ(arena.relocate(r2, to), newRef) << "relocating twice must yield the same reference";
+    EXPECT_EQ(to.size(), arena.size() - r2);
+    EXPECT_TRUE(test::setsEqual(to[newRef], {7, 1}));
+}
+
+TEST(clause_arena, remove_literal) {
+    using namespace sat;
+    ClauseArena arena;
+    const auto ref = arena.alloc(std::vector<Literal>{2, 5, 3, 8});
+    arena[ref].setSearchPos(3);
+    arena.removeLiteral(ref, 1);
+    EXPECT_EQ(arena[ref].size(), 3);
+    EXPECT_EQ(arena[ref][1], Literal(8)) << "last literal must take the place of the removed one";
+    EXPECT_EQ(arena[ref].getSearchPos(), 2);
+    EXPECT_EQ(arena.wasted(), 1);
+    ClauseArena to;
+    arena.relocate(ref, to);
+    EXPECT_EQ(to.size(), arena.size() - 1);
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
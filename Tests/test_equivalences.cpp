@@ -0,0 +1,108 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <algorithm>
+#include <vector>
+
+#include "Solver.hpp"
+#include "equivalences.hpp"
+#include "printing.hpp"
+
+namespace {
+    /**
+     * Creates the binary implication lists of the given binary clauses
+     * @param numVariables number of variables
+     * @param clauses binary clauses
+     * @return implication lists indexed by literal id
+     */
+    auto implications(std::size_t numVariables, const std::vector<std::vector<sat::Literal>> &clauses) {
+        std::vector<std::vector<sat::Literal>> result(2 * numVariables);
+        for (const auto &c : clauses) {
+            result[c[0].get()].emplace_back(c[1]);
+            result[c[1].get()].emplace_back(c[0]);
+        }
+
+        return result;
+    }
+}
+
+TEST(equivalences, find) {
+    using namespace sat;
+    // x0 -> x1 -> x2 -> x0, x2 -> x4 -> x1, x3 -> ¬x1
+    const auto graph = implications(5, {{neg(1), pos(0)}, {neg(2), pos(1)}, {neg(0), pos(2)}, {neg(3), neg(1)},
+                                        {pos(4), neg(2)}, {neg(4), pos(1)}});
+    const auto representatives = findEquivalences(graph);
+    ASSERT_TRUE(representatives.has_value());
+    const auto &repr = *representatives;
+    EXPECT_EQ(repr[pos(1).get()], pos(0));
+    EXPECT_EQ(repr[pos(2).get()], pos(0));
+    EXPECT_EQ(repr[neg(2).get()], neg(0)) << "negations must have negated representatives";
+    EXPECT_EQ(repr[pos(3).get()], pos(3)) << "one sided implications are no equivalences";
+    EXPECT_EQ(repr[pos(4).get()], pos(0));
+    EXPECT_EQ(repr[neg(4).get()], neg(0));
+}
+
+TEST(equivalences, contradiction) {
+    using namespace sat;
+    const auto graph = implications(2, {{neg(0), pos(1)}, {neg(1), pos(0)}, {pos(0), pos(1)}, {neg(0), neg(1)}});
+    EXPECT_FALSE(findEquivalences(graph).has_value());
+}
+
+TEST(equivalences, long_cycle) {
+    using namespace sat;
+    constexpr unsigned NumVariables = 200000;
+    std::vector<std::vector<Literal>> clauses;
+    for (unsigned x = 0; x < NumVariables; ++x) {
+        clauses.push_back({neg(x), pos((x + 1) % NumVariables)});
+    }
+
+    const auto representatives = findEquivalences(implications(NumVariables, clauses));
+    ASSERT_TRUE(representatives.has_value());
+    EXPECT_TRUE(std::ranges::all_of(*representatives, [](Literal l) { return var(l) == Variable(0); }));
+}
+
+TEST(equivalences, substitute) {
+    using namespace sat;
+    Solver solver(4);
+    auto clauses = {Clause({neg(0), pos(1)}), Clause({neg(1), pos(0)}), Clause({neg(2), neg(3)}),
+                    Clause({pos(3), pos(2)}), Clause({pos(1), pos(2), neg(0)}), Clause({neg(1), pos(3), neg(2)}),
+                    Clause({pos(0), pos(3)})};
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(solver.addClause(clause));
+    }
+
+    ASSERT_TRUE(solver.substituteEquivalences());
+    EXPECT_EQ(solver.getProfiler().getCount("substituted variables"), 2);
+    for (auto ref : solver.getClauseRefs()) {
+        const auto c = solver.getClause(ref);
+        EXPECT_TRUE(c.isDeleted() || std::ranges::none_of(c, [](Literal l) { return var(l).get() % 2 == 1; }))
+            << "substituted variables must not occur in clauses";
+    }
+
+    EXPECT_THAT(solver.getBinaryImplications(neg(0)), testing::ElementsAre(neg(2)));
+    EXPECT_TRUE(solver.getBinaryImplications(pos(1)).empty());
+    ASSERT_TRUE(solver.cdcl(4));
+    const auto model = solver.getModel();
+    ASSERT_EQ(model.size(), 4);
+    EXPECT_EQ(model[0].sign(), model[1].sign());
+    EXPECT_NE(model[2].sign(), model[3].sign());
+    for (const auto &clause : clauses) {
+        EXPECT_TRUE(std::ranges::any_of(clause, [&model](Literal l) {
+            return std::ranges::find(model, l) != model.end();
+        })) << "Clause " << clause << " is not satisfied by the model";
+    }
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
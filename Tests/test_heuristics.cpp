@@ -0,0 +1,157 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <algorithm>
+#include <vector>
+
+#include "heuristics.hpp"
+#include "util/IndexedHeap.hpp"
+
+TEST(indexed_heap, order) {
+    using namespace sat;
+    IndexedHeap<double> heap(6);
+    for (unsigned id : {0, 1, 2, 3, 4, 5}) {
+        heap.setKey(id, id % 3);
+        heap.push(id);
+    }
+
+    heap.push(4);
+    EXPECT_EQ(heap.size(), 6) << "pushing a contained id must not change the heap";
+    heap.setKey(0, 10);
+    heap.setKey(5, -1);
+    std::vector<unsigned> popped;
+    while (not heap.empty()) {
+        popped.emplace_back(heap.pop());
+    }
+
+    ASSERT_EQ(popped.size(), 6);
+    EXPECT_EQ(popped.front(), 0);
+    EXPECT_EQ(popped.back(), 5);
+    EXPECT_TRUE(std::ranges::is_sorted(popped, std::greater<>{}, [&heap](unsigned id) { return heap.key(id); }));
+    EXPECT_FALSE(heap.contains(3));
+}
+
+TEST(vsids, bump_and_select) {
+    using namespace sat;
+    std::vector model(5, TruthValue::Undefined);
+    VSIDS vsids(5);
+    vsids.onBump(3);
+    vsids.onConflict();
+    vsids.onBump(1);
+    EXPECT_GT(vsids.score(1), vsids.score(3)) << "later conflicts must weigh more";
+    EXPECT_EQ(vsids(model, 5), Variable(1));
+    EXPECT_EQ(vsids(model, 5), Variable(1)) << "selection must not change the heuristic";
+    model[1] = TruthValue::True;
+    EXPECT_EQ(vsids(model, 4), Variable(3));
+    model[3] = TruthValue::False;
+    EXPECT_NE(vsids(model, 3), Variable(3));
+    model[1] = TruthValue::Undefined;
+    vsids.onUnassign(1);
+    EXPECT_EQ(vsids(model, 4), Variable(1)) << "unassigned variables must be reinserted";
+}
+
+TEST(vsids, rescale) {
+    using namespace sat;
+    VSIDS vsids(2, 0.5);
+    for (int i = 0; i < 400; ++i) {
+        vsids.onBump(i % 2);
+        vsids.onConflict();
+    }
+
+    EXPECT_LE(vsids.score(0), VSIDS::RescaleLimit);
+    EXPECT_LE(vsids.score(1), VSIDS::RescaleLimit);
+    EXPECT_GT(vsids.score(1), vsids.score(0));
+}
+
+TEST(lrb, learning_rate) {
+    using namespace sat;
+    std::vector model(3, TruthValue::Undefined);
+    LRB lrb(3);
+    for (unsigned x : {0, 1, 2}) {
+        lrb.onAssign(x);
+        model[x] = TruthValue::True;
+    }
+
+    // x0 takes part in both conflicts, x1 in one as reason side variable, x2 in none
+    lrb.onBump(0);
+    lrb.onConflict();
+    lrb.onBump(0);
+    lrb.onReasonSide(1);
+    lrb.onConflict();
+    for (unsigned x : {2, 1, 0}) {
+        model[x] = TruthValue::Undefined;
+        lrb.onUnassign(x);
+    }
+
+    EXPECT_DOUBLE_EQ(lrb.score(0), LRB::InitialStepSize - 2 * LRB::StepSizeDecrement);
+    EXPECT_DOUBLE_EQ(lrb.score(1), lrb.score(0) / 2);
+    EXPECT_EQ(lrb.score(2), 0);
+    EXPECT_EQ(lrb(model, 3), Variable(0));
+}
+
+TEST(vmtf, move_to_front) {
+    using namespace sat;
+    std::vector model(5, TruthValue::Undefined);
+    VMTF vmtf(5);
+    EXPECT_EQ(vmtf(model, 5), Variable(0));
+    model[0] = TruthValue::True;
+    EXPECT_EQ(vmtf(model, 4), Variable(1));
+    model[1] = TruthValue::True;
+    model[4] = TruthValue::False;
+    vmtf.onBump(4);
+    vmtf.onBump(0);
+    vmtf.onConflict();
+    EXPECT_GT(vmtf.score(0), vmtf.score(4)) << "bumping must keep the relative order";
+    EXPECT_EQ(vmtf(model, 2), Variable(2));
+    model[0] = TruthValue::Undefined;
+    vmtf.onUnassign(0);
+    EXPECT_EQ(vmtf(model, 3), Variable(0)) << "most recently bumped variable must be selected";
+    model[4] = TruthValue::Undefined;
+    vmtf.onUnassign(4);
+    EXPECT_EQ(vmtf(model, 4), Variable(0));
+    model[0] = TruthValue::False;
+    EXPECT_EQ(vmtf(model, 3), Variable(4));
+}
+
+TEST(heuristic, make_heuristic) {
+    using namespace sat;
+    std::vector model(3, TruthValue::Undefined);
+    for (const auto *name : {"vsids", "vmtf", "lrb", "first"}) {
+        auto h = makeHeuristic(name, 3);
+        const auto x = std::visit([&model](auto &impl) { return impl(model, 3); }, h);
+        EXPECT_EQ(model[x.get()], TruthValue::Undefined);
+    }
+
+    EXPECT_THROW(makeHeuristic("unknown", 3), std::invalid_argument);
+}
+
+TEST(heuristic, hooks) {
+    using namespace sat;
+    struct Counting {
+        unsigned *assigned;
+        Variable operator()(const std::vector<TruthValue> &, std::size_t) const { return 0; }
+        void onAssign(Variable) { ++*assigned; }
+    };
+
+    unsigned numAssigned = 0;
+    Heuristic h(Counting{&numAssigned});
+    h.onAssign(2);
+    h.onUnassign(2);
+    h.onBump(2);
+    h.onConflict();
+    EXPECT_EQ(numAssigned, 1) << "implemented hooks must be forwarded, missing hooks are ignored";
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
@@ -0,0 +1,65 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "literal_scan.hpp"
+
+TEST(literal_scan, find_non_falsified) {
+    using namespace sat;
+    constexpr std::uint32_t NumLiterals = 200;
+    std::mt19937 rng(7);
+    std::vector<std::int8_t> values(NumLiterals + ScanPadding, 0);
+    std::vector<std::uint32_t> literals;
+    for (std::size_t size : {0, 1, 7, 8, 9, 16, 31, 64}) {
+        for (unsigned rep = 0; rep < 50; ++rep) {
+            for (std::uint32_t id = 0; id < NumLiterals; id += 2) {
+                // most literals are false, so that the first open literal is found late
+                const std::int8_t value = rng() % 8 == 0 ? (rng() % 2 ? 1 : 0) : -1;
+                values[id] = value;
+                values[id + 1] = static_cast<std::int8_t>(-value);
+            }
+
+            literals.clear();
+            for (std::size_t i = 0; i < size; ++i) {
+                literals.emplace_back(rng() % NumLiterals);
+            }
+
+            const auto expected = detail::findNonFalsifiedScalar(literals.data(), size, values.data());
+            ASSERT_LE(expected, size);
+            EXPECT_EQ(findNonFalsified(literals.data(), size, values.data()), expected);
+#ifdef SAT_HAS_AVX2_SCAN
+            if (detail::hasVectorScan()) {
+                EXPECT_EQ(detail::findNonFalsifiedAvx2(literals.data(), size, values.data()), expected);
+            }
+#endif
+        }
+    }
+}
+
+TEST(literal_scan, padding) {
+    using namespace sat;
+    // the last literal id is read with ScanPadding bytes behind it
+    std::vector<std::int8_t> values(16 + ScanPadding, -1);
+    std::vector<std::uint32_t> literals(16, 15);
+    values[15] = 0;
+    EXPECT_EQ(findNonFalsified(literals.data(), literals.size(), values.data()), 0);
+    values[15] = -1;
+    EXPECT_EQ(findNonFalsified(literals.data(), literals.size(), values.data()), 16);
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
@@ -0,0 +1,86 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <vector>
+
+#include "modes.hpp"
+
+TEST(modes, switching) {
+    using namespace sat;
+    static_assert(heuristic<ModeController> && restart_policy<ModeController>);
+    ModeController modes(3);
+    EXPECT_EQ(modes.getMode(), Mode::Focused);
+    EXPECT_FALSE(modes.useTargetPhases());
+    for (std::uint64_t i = 0; i < ModeController::FirstBudget; ++i) {
+        modes.onConflict(1, 1);
+        if (modes.shouldRestart() and i + 1 < ModeController::FirstBudget) {
+            modes.onRestart();
+        }
+    }
+
+    EXPECT_EQ(modes.getMode(), Mode::Focused) << "mode must only be switched at restarts";
+    ASSERT_TRUE(modes.shouldRestart()) << "exhausted budget must trigger a restart";
+    modes.onRestart();
+    EXPECT_EQ(modes.getMode(), Mode::Stable);
+    EXPECT_TRUE(modes.useTargetPhases());
+    EXPECT_FALSE(modes.shouldRestart());
+    for (std::uint64_t i = 0; i < ModeController::FirstBudget; ++i) {
+        modes.onConflict(1, 1);
+    }
+
+    modes.onRestart();
+    EXPECT_EQ(modes.getMode(), Mode::Focused);
+    EXPECT_EQ(modes.getNumSwitches(), 2);
+    for (std::uint64_t i = 0; i < ModeController::FirstBudget; ++i) {
+        modes.onConflict(1, 1);
+    }
+
+    modes.onRestart();
+    EXPECT_EQ(modes.getMode(), Mode::Focused) << "budget must grow after a stable mode";
+    for (std::uint64_t i = 0; i < ModeController::FirstBudget; ++i) {
+        modes.onConflict(1, 1);
+    }
+
+    modes.onRestart();
+    ASSERT_EQ(modes.getMode(), Mode::Stable);
+    for (std::uint64_t i = 0; i < ModeController::FirstBudget / 10; ++i) {
+        modes.onConflict(1, 1);
+    }
+
+    EXPECT_FALSE(modes.shouldRestart()) << "conflicts of the previous stable mode must not count";
+}
+
+TEST(modes, heuristics) {
+    using namespace sat;
+    std::vector model(3, TruthValue::Undefined);
+    ModeController modes(3);
+    model[2] = TruthValue::True;
+    modes.onAssign(2);
+    modes.onBump(2);
+    modes.onConflict();
+    model[2] = TruthValue::Undefined;
+    modes.onUnassign(2);
+    EXPECT_EQ(modes(model, 3), Variable(2));
+    for (std::uint64_t i = 0; i < ModeController::FirstBudget; ++i) {
+        modes.onConflict(1, 1);
+    }
+
+    modes.onRestart();
+    ASSERT_EQ(modes.getMode(), Mode::Stable);
+    EXPECT_EQ(modes(model, 3), Variable(2)) << "inactive heuristic must be kept up to date";
+    EXPECT_GT(modes.score(2), modes.score(0));
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
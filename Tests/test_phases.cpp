@@ -0,0 +1,68 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <vector>
+
+#include "phases.hpp"
+
+TEST(phases, save_and_target) {
+    using namespace sat;
+    Phases phases(3);
+    EXPECT_EQ(phases.decide(0, true), pos(0)) << "initial phase must be positive";
+    phases.save(neg(0));
+    EXPECT_EQ(phases.decide(0, false), neg(0));
+    phases.update(std::vector{pos(0), neg(1)});
+    phases.update(std::vector{neg(1)});
+    EXPECT_EQ(phases.decide(0, true), pos(0)) << "target must come from the longest trail";
+    EXPECT_EQ(phases.decide(1, true), neg(1));
+    EXPECT_EQ(phases.decide(0, false), neg(0)) << "target must not change the saved phase";
+    EXPECT_EQ(phases.decide(2, true), pos(2)) << "saved phase must be used without target";
+}
+
+TEST(phases, rephase) {
+    using namespace sat;
+    Phases phases(2);
+    phases.update(std::vector{neg(0)});
+    phases.save(pos(0));
+    phases.save(neg(1));
+    for (auto method : Phases::Schedule) {
+        EXPECT_EQ(phases.nextRephase(), method);
+    }
+
+    EXPECT_EQ(phases.nextRephase(), Phases::Schedule.front()) << "schedule must repeat";
+    EXPECT_EQ(phases.getNumRephases(), Phases::Schedule.size() + 1);
+    phases.rephase(Phases::Rephase::Best);
+    EXPECT_EQ(phases.decide(0, false), neg(0));
+    EXPECT_EQ(phases.decide(1, false), neg(1)) << "variables without best phase must keep their phase";
+    phases.rephase(Phases::Rephase::Inverted);
+    EXPECT_EQ(phases.decide(0, true), neg(0)) << "rephasing must reset the target phases";
+    phases.rephase(Phases::Rephase::Original);
+    EXPECT_EQ(phases.decide(1, false), pos(1));
+}
+
+TEST(phases, walk) {
+    using namespace sat;
+    // satisfied only by x0 = 1, x1 = 0, x2 = 1
+    std::vector<std::vector<Literal>> clauses{{pos(0), pos(1)}, {neg(1)}, {neg(0), pos(2)}, {neg(2), neg(1)},
+                                              {pos(2), pos(1)}};
+    std::vector<char> phases{0, 1, 0};
+    EXPECT_EQ(walk(clauses, phases, 100, 42), 0);
+    EXPECT_THAT(phases, testing::ElementsAre(1, 0, 1));
+    std::vector<std::vector<Literal>> unsat{{pos(0)}, {neg(0)}};
+    phases = {1};
+    EXPECT_EQ(walk(unsat, phases, 10), 1);
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
@@ -0,0 +1,139 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+#include "Solver.hpp"
+#include "inout.hpp"
+#include "preprocessing.hpp"
+#include "printing.hpp"
+#include "reconstruction.hpp"
+#include "testing_utils.hpp"
+
+namespace {
+    /**
+     * Preprocesses the given instance, solves the simplified formula and checks the extended model
+     * @param cnfFile instance
+     * @return whether the instance is satisfiable
+     */
+    bool preprocessAndSolve(const std::string &cnfFile) {
+        using namespace sat;
+        std::ifstream ifs(cnfFile);
+        EXPECT_TRUE(ifs.is_open()) << "Could not open file " << cnfFile;
+        const auto [clauses, numVariables] = inout::read_from_dimacs(ifs);
+        Preprocessor preprocessor(numVariables);
+        bool ok = true;
+        for (const auto &clause : clauses) {
+            ok = preprocessor.addClause(clause) && ok;
+        }
+
+        ok = ok && preprocessor.eliminate();
+        Solver solver(numVariables);
+        for (const auto &clause : preprocessor.getClauses()) {
+            ok = ok && solver.addClause(Clause(clause));
+        }
+
+        if (not ok or not solver.cdcl(numVariables)) {
+            return false;
+        }
+
+        const auto model = preprocessor.getReconstructionStack().extend(solver.getModel(), numVariables);
+        for (const auto &clause : clauses) {
+            EXPECT_TRUE(std::ranges::any_of(clause, [&model](Literal l) {
+                return std::ranges::find(model, l) != model.end();
+            })) << "Clause " << Clause(clause) << " is not satisfied by the extended model";
+        }
+
+        return true;
+    }
+}
+
+TEST(reconstruction, extend) {
+    using namespace sat;
+    ReconstructionStack stack;
+    stack.push(pos(0), std::vector{pos(0), pos(1)});
+    stack.push(neg(0), std::vector{neg(0), pos(2)});
+    // models of the resolvent (x1 ∨ x2)
+    std::vector model{TruthValue::True, TruthValue::True, TruthValue::False};
+    stack.extend(model);
+    EXPECT_THAT(model, testing::ElementsAre(TruthValue::False, TruthValue::True, TruthValue::False));
+    model = {TruthValue::False, TruthValue::False, TruthValue::True};
+    stack.extend(model);
+    EXPECT_THAT(model, testing::ElementsAre(TruthValue::True, TruthValue::False, TruthValue::True));
+}
+
+TEST(preprocessing, eliminate) {
+    using namespace sat;
+    constexpr unsigned NumVariables = 4;
+    const std::vector<std::vector<Literal>> clauses{{pos(0), pos(1)}, {neg(0), pos(2)}, {neg(0), pos(3), pos(3)},
+                                                    {neg(1), neg(2)}, {pos(2), neg(3)}, {pos(1), neg(1)}};
+    Preprocessor preprocessor(NumVariables);
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(preprocessor.addClause(clause));
+    }
+
+    ASSERT_TRUE(preprocessor.eliminate());
+    EXPECT_GE(preprocessor.getNumEliminated(), 1);
+    const auto simplified = preprocessor.getClauses();
+    EXPECT_LT(simplified.size(), clauses.size());
+    const auto satisfies = [](const auto &model, const auto &formula) {
+        return std::ranges::all_of(formula, [&model](const auto &clause) {
+            return std::ranges::any_of(clause, [&model](Literal l) {
+                return std::ranges::find(model, l) != model.end();
+            });
+        });
+    };
+
+    // every model of the simplified formula must extend to a model of the original formula
+    for (unsigned bits = 0; bits < (1u << NumVariables); ++bits) {
+        std::vector<Literal> model;
+        for (unsigned x = 0; x < NumVariables; ++x) {
+            model.emplace_back(bits & (1u << x) ? pos(x) : neg(x));
+        }
+
+        if (satisfies(model, simplified)) {
+            EXPECT_TRUE(satisfies(preprocessor.getReconstructionStack().extend(model, NumVariables), clauses));
+        }
+    }
+}
+
+TEST(preprocessing, units) {
+    using namespace sat;
+    Preprocessor preprocessor(3);
+    ASSERT_TRUE(preprocessor.addClause({pos(0), pos(1), pos(2)}));
+    ASSERT_TRUE(preprocessor.addClause({neg(0)}));
+    ASSERT_TRUE(preprocessor.addClause({neg(1)}));
+    ASSERT_TRUE(preprocessor.eliminate());
+    const auto clauses = preprocessor.getClauses();
+    EXPECT_THAT(clauses, testing::UnorderedElementsAre(std::vector{neg(0)}, std::vector{neg(1)},
+                                                       std::vector{pos(2)}));
+    ASSERT_TRUE(preprocessor.addClause({neg(2)}) == false) << "conflicting unit must make the formula unsatisfiable";
+}
+
+TEST(preprocessing, search) {
+    for (auto instance : test::TestData::SatInstances) {
+        EXPECT_TRUE(preprocessAndSolve(instance)) << instance << " is satisfiable";
+    }
+
+    for (auto instance : test::TestData::UnsatInstances) {
+        EXPECT_FALSE(preprocessAndSolve(instance)) << instance << " is unsatisfiable";
+    }
+
+    EXPECT_FALSE(preprocessAndSolve(test::TestData::PigeonHoleProblem));
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
@@ -0,0 +1,103 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "restarts.hpp"
+
+namespace {
+    /**
+     * Counts the conflicts until the policy requests a restart
+     */
+    template<sat::restart_policy P>
+    std::uint64_t nextInterval(P &policy, unsigned lbd = 5, std::size_t trailSize = 10) {
+        std::uint64_t conflicts = 0;
+        do {
+            policy.onConflict(lbd, trailSize);
+            ++conflicts;
+        } while (not policy.shouldRestart());
+
+        policy.onRestart();
+        return conflicts;
+    }
+}
+
+TEST(restarts, luby_sequence) {
+    const std::vector<std::uint64_t> expected{1, 1, 2, 1, 1, 2, 4, 1, 1, 2, 1, 1, 2, 4, 8, 1};
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(sat::luby(i), expected[i]) << "at index " << i;
+    }
+}
+
+TEST(restarts, luby_policy) {
+    sat::LubyRestarts policy(10);
+    for (std::uint64_t factor : {1, 1, 2, 1, 1, 2, 4}) {
+        EXPECT_EQ(nextInterval(policy), 10 * factor);
+    }
+}
+
+TEST(restarts, geometric_policy) {
+    sat::GeometricRestarts policy(100, 2);
+    EXPECT_EQ(nextInterval(policy), 100);
+    EXPECT_EQ(nextInterval(policy), 200);
+    EXPECT_EQ(nextInterval(policy), 400);
+}
+
+TEST(restarts, glucose_policy) {
+    using sat::GlucoseRestarts;
+    GlucoseRestarts policy;
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+        policy.onConflict(5, 10);
+        EXPECT_FALSE(policy.shouldRestart()) << "constant literal block distances must not trigger restarts";
+    }
+
+    policy.onRestart();
+    EXPECT_EQ(nextInterval(policy, 20), GlucoseRestarts::MinInterval);
+    // a trail much larger than average blocks the restart
+    for (std::uint64_t i = 0; i < GlucoseRestarts::BlockingStart; ++i) {
+        policy.onConflict(5, 10);
+    }
+
+    policy.onRestart();
+    for (std::uint64_t i = 1; i < GlucoseRestarts::MinInterval; ++i) {
+        policy.onConflict(20, 10);
+    }
+
+    policy.onConflict(20, 100);
+    EXPECT_FALSE(policy.shouldRestart());
+    EXPECT_EQ(policy.getNumBlocked(), 1);
+}
+
+TEST(restarts, ema) {
+    sat::ExponentialMovingAverage ema(0.5);
+    EXPECT_EQ(ema.get(), 0);
+    ema.update(4);
+    EXPECT_DOUBLE_EQ(ema.get(), 4) << "first value must not be biased";
+    ema.update(1);
+    EXPECT_GT(ema.get(), 1);
+    EXPECT_LT(ema.get(), 2.5);
+}
+
+TEST(restarts, make_restart_policy) {
+    for (const auto *name : {"glucose", "luby", "geometric", "none"}) {
+        EXPECT_NO_THROW(sat::makeRestartPolicy(name));
+    }
+
+    EXPECT_THROW(sat::makeRestartPolicy("unknown"), std::invalid_argument);
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
@@ -0,0 +1,256 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Solver.hpp"
+#include "inout.hpp"
+#include "printing.hpp"
+#include "testing_utils.hpp"
+
+namespace {
+    using Search = std::function<bool(sat::Solver &, unsigned)>;
+
+    auto loadProblem(const std::string &cnfFile) {
+        std::ifstream ifs(cnfFile);
+        if (not ifs.is_open()) {
+            std::cerr << "Could not open file " << cnfFile << ". This should never happen" << std::endl;
+            std::exit(1);
+        }
+
+        return sat::inout::read_from_dimacs(ifs);
+    }
+
+    bool solve(const std::string &cnfFile, const Search &search, bool checkModel) {
+        using namespace sat;
+        auto [clauses, numVariables] = loadProblem(cnfFile);
+        Solver solver(numVariables);
+        bool ok = true;
+        for (const auto &clause : clauses) {
+            ok = solver.addClause(Clause(clause)) && ok;
+        }
+
+        if (not ok or not search(solver, numVariables)) {
+            return false;
+        }
+
+        if (checkModel) {
+            // substituted variables only get their values through the reconstruction in getModel
+            const auto model = solver.getModel();
+            for (const auto &clause : clauses) {
+                EXPECT_TRUE(std::ranges::any_of(clause, [&model](Literal l) {
+                    return std::ranges::find(model, l) != model.end();
+                })) << "Clause " << clause << " is not satisfied by the model";
+            }
+        }
+
+        return true;
+    }
+
+    class search : public testing::TestWithParam<std::pair<std::string, Search>> {};
+}
+
+TEST_P(search, satisfiable) {
+    for (auto instance : test::TestData::SatInstances) {
+        EXPECT_TRUE(solve(instance, GetParam().second, true)) << instance << " is satisfiable";
+    }
+}
+
+TEST_P(search, unsatisfiable) {
+    for (auto instance : test::TestData::UnsatInstances) {
+        EXPECT_FALSE(solve(instance, GetParam().second, false)) << instance << " is unsatisfiable";
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(algorithms, search, testing::Values(
+    std::make_pair("dpll", Search([](sat::Solver &s, unsigned n) { return s.dpll(n); })),
+    std::make_pair("cdcl", Search([](sat::Solver &s, unsigned n) { return s.cdcl(n); })),
+    std::make_pair("cdcl_lrb", Search([](sat::Solver &s, unsigned n) {
+        s.setHeuristic(sat::LRB(n));
+        return s.cdcl(n);
+    })),
+    std::make_pair("cdcl_luby", Search([](sat::Solver &s, unsigned n) {
+        s.setRestartPolicy(sat::LubyRestarts());
+        return s.cdcl(n);
+    })),
+    std::make_pair("cdcl_geometric", Search([](sat::Solver &s, unsigned n) {
+        s.setRestartPolicy(sat::GeometricRestarts());
+        return s.cdcl(n);
+    })),
+    std::make_pair("cdcl_modes", Search([](sat::Solver &s, unsigned n) {
+        s.setModeSwitching(true);
+        return s.cdcl(n);
+    })),
+    std::make_pair("cdcl_chrono", Search([](sat::Solver &s, unsigned n) {
+        s.setChronologicalBacktracking(0);
+        return s.cdcl(n);
+    })),
+    std::make_pair("cdcl_subsume", Search([](sat::Solver &s, unsigned n) {
+        return s.subsume() && s.cdcl(n);
+    })),
+    std::make_pair("cdcl_equivalences", Search([](sat::Solver &s, unsigned n) {
+        return s.probe() && s.substituteEquivalences() && s.cdcl(n);
+    }))),
+    [](const auto &info) { return info.param.first; });
+
+TEST(cdcl, clause_database_reduction) {
+    using namespace sat;
+    auto [clauses, numVariables] = loadProblem(test::TestData::PigeonHoleProblem);
+    Solver solver(numVariables);
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(solver.addClause(Clause(clause)));
+    }
+
+    EXPECT_FALSE(solver.cdcl(numVariables));
+    const auto &profiler = solver.getProfiler();
+    EXPECT_GT(profiler.getCount("clause database reductions"), 0);
+    EXPECT_GT(profiler.getCount("reduction dropped clauses"), 0);
+    EXPECT_LT(solver.getLearntClauseRefs().size(), profiler.getCount("conflicts"));
+    for (auto ref : solver.getLearntClauseRefs()) {
+        EXPECT_TRUE(solver.getClause(ref).isLearnt());
+        EXPECT_GE(solver.getClause(ref).getLbd(), 1);
+    }
+}
+
+TEST(cdcl, reduction_tiers) {
+    using namespace sat;
+    // learns clauses of all three tiers
+    auto [clauses, numVariables] = loadProblem(__TEST_DATA_DIR__ "../../eval/sat/medium/bw_large.b.cnf");
+    Solver solver(numVariables);
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(solver.addClause(Clause(clause)));
+    }
+
+    ASSERT_TRUE(solver.cdcl(numVariables));
+    solver.backtrack(0);
+    const auto literals = [&solver](ClauseRef ref) {
+        const auto c = solver.getClause(ref);
+        std::vector<Literal> result(c.begin(), c.end());
+        std::ranges::sort(result, {}, [](Literal l) { return l.get(); });
+        return result;
+    };
+
+    // new clauses are marked as used, the local clause with the highest literal block distance is the worst candidate
+    std::vector<std::vector<Literal>> tier2;
+    std::optional<ClauseRef> worst;
+    for (auto ref : solver.getLearntClauseRefs()) {
+        const auto c = solver.getClause(ref);
+        ASSERT_TRUE(c.isUsed());
+        if (c.getLbd() > Solver::CoreLbd && c.getLbd() <= Solver::Tier2Lbd) {
+            tier2.emplace_back(literals(ref));
+        } else if (c.getLbd() > Solver::Tier2Lbd) {
+            const auto w = worst ? std::optional(solver.getClause(*worst)) : std::nullopt;
+            if (not w or c.getLbd() > w->getLbd() or (c.getLbd() == w->getLbd() and c.getActivity() < w->getActivity())) {
+                worst = ref;
+            }
+        }
+    }
+
+    ASSERT_TRUE(worst.has_value());
+    ASSERT_FALSE(tier2.empty());
+    const auto worstLiterals = literals(*worst);
+    solver.reduceLearntClauses();
+    std::vector<std::vector<Literal>> remaining;
+    for (auto ref : solver.getLearntClauseRefs()) {
+        const auto c = solver.getClause(ref);
+        EXPECT_TRUE(c.getLbd() <= Solver::CoreLbd or not c.isUsed()) << "reductions clear the used flags";
+        remaining.emplace_back(literals(ref));
+    }
+
+    EXPECT_THAT(remaining, testing::Not(testing::Contains(worstLiterals)))
+        << "used clauses of the local tier must not be protected";
+    for (const auto &clause : tier2) {
+        EXPECT_THAT(remaining, testing::Contains(clause)) << "used tier 2 clauses must be kept";
+    }
+}
+
+TEST(cdcl, repeated_equivalence_substitution) {
+    using namespace sat;
+    auto [clauses, numVariables] = loadProblem(*std::ranges::rbegin(test::TestData::SatInstances));
+    // variables are shifted by two, x0 and x1 are fresh variables that become the representatives
+    numVariables += 2;
+    for (auto &clause : clauses) {
+        std::ranges::transform(clause, clause.begin(), [](Literal l) { return Literal(l.get() + 4); });
+    }
+
+    Solver solver(numVariables);
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(solver.addClause(Clause(clause)));
+    }
+
+    ASSERT_TRUE(solver.cdcl(numVariables));
+    solver.backtrack(0);
+    // substitutes the equivalences of the instance, so that the rounds below start with earlier reconstruction entries
+    ASSERT_TRUE(solver.substituteEquivalences());
+    const auto learnt = std::ranges::find_if(solver.getLearntClauseRefs(), [&solver](ClauseRef ref) {
+        const auto c = solver.getClause(ref);
+        return not c.isDeleted() and std::ranges::none_of(c, [&solver](Literal l) {
+            return solver.satisfied(l) or solver.falsified(l);
+        });
+    });
+    ASSERT_NE(learnt, solver.getLearntClauseRefs().end());
+    const auto x = var(solver.getClause(*learnt)[0]);
+    const auto addEquivalence = [&](Literal a, Literal b) {
+        clauses.push_back({a.negate(), b});
+        clauses.push_back({a, b.negate()});
+        return solver.addClause(Clause({a.negate(), b})) && solver.addClause(Clause({a, b.negate()}));
+    };
+
+    const auto occurs = [&solver](Variable y) {
+        const auto contains = [&solver, y](ClauseRef ref) {
+            const auto c = solver.getClause(ref);
+            return not c.isDeleted() and std::ranges::any_of(c, [y](Literal l) { return var(l) == y; });
+        };
+        return std::ranges::any_of(solver.getClauseRefs(), contains) or
+               std::ranges::any_of(solver.getLearntClauseRefs(), contains);
+    };
+
+    // the first round replaces x by ¬x1 in the learned clause, the second one replaces the representative x1 by x0
+    const auto substituted = solver.getProfiler().getCount("substituted variables");
+    ASSERT_TRUE(addEquivalence(pos(1), neg(x)));
+    ASSERT_TRUE(solver.substituteEquivalences());
+    EXPECT_EQ(solver.getProfiler().getCount("substituted variables"), substituted + 1);
+    EXPECT_FALSE(occurs(x));
+    EXPECT_TRUE(occurs(1));
+    ASSERT_TRUE(addEquivalence(pos(0), pos(1)));
+    ASSERT_TRUE(solver.substituteEquivalences());
+    EXPECT_EQ(solver.getProfiler().getCount("substituted variables"), substituted + 2);
+    EXPECT_FALSE(occurs(1));
+    EXPECT_FALSE(occurs(x));
+    EXPECT_TRUE(std::ranges::any_of(solver.getLearntClauseRefs(), [&solver](ClauseRef ref) {
+        const auto c = solver.getClause(ref);
+        return not c.isDeleted() and std::ranges::any_of(c, [](Literal l) { return var(l) == Variable(0); });
+    })) << "the learned clause must be rewritten twice";
+    for (auto ref : solver.getLearntClauseRefs()) {
+        const auto c = solver.getClause(ref);
+        EXPECT_TRUE(c.isDeleted() or (c.isLearnt() and c.getLbd() >= 1 and c.getLbd() <= c.size()));
+    }
+
+    ASSERT_TRUE(solver.cdcl(numVariables));
+    const auto model = solver.getModel();
+    ASSERT_EQ(model.size(), numVariables);
+    for (const auto &clause : clauses) {
+        EXPECT_TRUE(std::ranges::any_of(clause, [&model](Literal l) {
+            return std::ranges::find(model, l) != model.end();
+        })) << "Clause " << clause << " is not satisfied by the extended model";
+    }
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
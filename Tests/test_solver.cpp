@@ -122,6 +122,202 @@ TEST(solver, rebase) {
         << "Clause " << Clause({neg(1), pos(2)}) << " was not found";
 }
 
+TEST(solver, rebase_duplicates) {
+    using namespace sat;
+    Solver s(4);
+    auto clauses = {Clause({neg(1), pos(0), neg(2)}), Clause({neg(2), pos(3), neg(1)}), Clause({neg(1), neg(2)}),
+                    Clause({pos(2), pos(3)})};
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(s.addClause(clause));
+    }
+
+    ASSERT_TRUE(s.assign(neg(0)));
+    ASSERT_TRUE(s.assign(neg(3)));
+    const auto rebased = s.rebase();
+    EXPECT_EQ(rebased.size(), 4) << "the three reduced clauses (¬x1 ∨ ¬x2) must be contained once";
+    EXPECT_TRUE(test::findClause(Clause({neg(2), neg(1)}), rebased));
+    EXPECT_TRUE(test::findClause(Clause({pos(2)}), rebased));
+}
+
+TEST(solver, clause_deduplication) {
+    using namespace sat;
+    Solver s(3);
+    s.setClauseDeduplication(true);
+    ASSERT_TRUE(s.addClause(Clause({pos(0), neg(1), pos(2)})));
+    ASSERT_TRUE(s.addClause(Clause({pos(2), pos(0), neg(1)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(1), pos(0)})));
+    ASSERT_TRUE(s.addClause(Clause({pos(0), neg(1), pos(0)})));
+    EXPECT_EQ(s.getClauseRefs().size(), 1);
+    EXPECT_EQ(s.getBinaryImplications(pos(0)).size(), 1);
+    EXPECT_EQ(s.getProfiler().getCount("duplicate clauses"), 2);
+    s.setClauseDeduplication(false);
+    ASSERT_TRUE(s.addClause(Clause({pos(2), pos(0), neg(1)})));
+    EXPECT_EQ(s.getClauseRefs().size(), 2);
+}
+
+TEST(solver, trail_levels_backtrack) {
+    using namespace sat;
+    Solver s(4);
+    ASSERT_TRUE(s.addClause(Clause({neg(0), pos(1)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(1), neg(2), pos(3)})));
+    ASSERT_TRUE(s.addClause(Clause({pos(2)})));
+    ASSERT_TRUE(s.unitPropagate());
+    EXPECT_EQ(s.decisionLevel(), 0);
+    EXPECT_EQ(s.level(2), 0);
+    s.decide(pos(0));
+    ASSERT_TRUE(s.unitPropagate());
+    EXPECT_EQ(s.decisionLevel(), 1);
+    EXPECT_EQ(s.val(3), TruthValue::True);
+    EXPECT_EQ(s.level(1), 1);
+    EXPECT_EQ(s.level(3), 1);
+    EXPECT_EQ(s.reason(0).getKind(), Reason::Kind::None);
+    ASSERT_EQ(s.reason(1).getKind(), Reason::Kind::Binary);
+    EXPECT_EQ(s.reason(1).getLiteral(), neg(0));
+    EXPECT_EQ(s.reason(3).getKind(), Reason::Kind::Clause);
+    s.backtrack(0);
+    EXPECT_EQ(s.decisionLevel(), 0);
+    for (unsigned varId : {0, 1, 3}) {
+        EXPECT_EQ(s.val(varId), TruthValue::Undefined);
+    }
+
+    EXPECT_EQ(s.val(2), TruthValue::True);
+    s.decide(neg(3));
+    ASSERT_TRUE(s.unitPropagate());
+    EXPECT_EQ(s.val(1), TruthValue::False);
+    EXPECT_EQ(s.val(0), TruthValue::False);
+}
+
+TEST(solver, literal_values) {
+    using namespace sat;
+    Solver s(2);
+    ASSERT_TRUE(s.assign(neg(1)));
+    EXPECT_TRUE(s.satisfied(neg(1)));
+    EXPECT_TRUE(s.falsified(pos(1)));
+    EXPECT_FALSE(s.satisfied(pos(0)) || s.falsified(pos(0)) || s.falsified(neg(0)));
+    ASSERT_TRUE(s.assign(pos(0)));
+    EXPECT_TRUE(s.satisfied(pos(0)));
+    EXPECT_TRUE(s.falsified(neg(0)));
+    EXPECT_EQ(s.val(0), TruthValue::True);
+    EXPECT_EQ(s.val(1), TruthValue::False);
+}
+
+TEST(solver, chronological_backtrack) {
+    using namespace sat;
+    Solver s(4);
+    s.setChronologicalBacktracking(0);
+    ASSERT_TRUE(s.addClause(Clause({neg(2), pos(3)})));
+    s.decide(pos(0));
+    s.decide(pos(1));
+    // implied by the literal of level 1 while at level 2
+    ASSERT_TRUE(s.assign(pos(2), Reason::binary(neg(0))));
+    EXPECT_EQ(s.level(2), 1);
+    ASSERT_TRUE(s.unitPropagate());
+    EXPECT_EQ(s.level(3), 1) << "implied literals must get the highest level of their reason";
+    s.backtrack(1);
+    EXPECT_EQ(s.decisionLevel(), 1);
+    EXPECT_EQ(s.val(1), TruthValue::Undefined);
+    EXPECT_EQ(s.val(2), TruthValue::True) << "literals of lower levels must be kept";
+    EXPECT_EQ(s.val(3), TruthValue::True);
+    s.backtrack(0);
+    for (unsigned varId : {0, 1, 2, 3}) {
+        EXPECT_EQ(s.val(varId), TruthValue::Undefined);
+    }
+}
+
+TEST(solver, binary_implications) {
+    using namespace sat;
+    Solver s(3);
+    ASSERT_TRUE(s.addClause(Clause({neg(0), pos(1)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(1), neg(2)})));
+    EXPECT_TRUE(s.getClauseRefs().empty()) << "binary clauses must not be stored in the clause arena";
+    EXPECT_THAT(s.getBinaryImplications(neg(0)), testing::ElementsAre(pos(1)));
+    EXPECT_THAT(s.getBinaryImplications(pos(1)), testing::ElementsAre(neg(0)));
+    ASSERT_TRUE(s.assign(pos(0)));
+    ASSERT_TRUE(s.unitPropagate());
+    EXPECT_EQ(s.val(1), TruthValue::True);
+    EXPECT_EQ(s.val(2), TruthValue::False);
+}
+
+TEST(solver, probing) {
+    using namespace sat;
+    Solver s(5);
+    // x0 fails, x4 is implied by x3 and, since x0 is false, by ¬x3
+    auto clauses = {Clause({neg(0), pos(1)}), Clause({neg(0), pos(2)}), Clause({neg(1), neg(2)}),
+                    Clause({neg(3), pos(4)}), Clause({pos(3), pos(4), pos(0)})};
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(s.addClause(clause));
+    }
+
+    ASSERT_TRUE(s.probe());
+    EXPECT_EQ(s.decisionLevel(), 0);
+    EXPECT_EQ(s.val(0), TruthValue::False) << "failed literal must be learned";
+    EXPECT_EQ(s.val(4), TruthValue::True) << "necessary assignment must be learned";
+    EXPECT_EQ(s.val(3), TruthValue::Undefined);
+    EXPECT_THAT(s.getBinaryImplications(pos(3)), testing::Contains(pos(4))) << "hyper-binary resolvent is missing";
+    const auto &profiler = s.getProfiler();
+    EXPECT_EQ(profiler.getCount("probes"), 3) << "x0 fails, so only x3 is probed with both polarities";
+    EXPECT_EQ(profiler.getCount("failed literals"), 1);
+    EXPECT_EQ(profiler.getCount("necessary assignments"), 1);
+    EXPECT_EQ(profiler.getCount("hyper-binary resolvents"), 1);
+}
+
+TEST(solver, probing_dominator) {
+    using namespace sat;
+    Solver s(5);
+    // x0 -> x1 -> x2, x1 -> x3 and x2 ∧ x3 -> x4
+    auto clauses = {Clause({neg(0), pos(1)}), Clause({neg(1), pos(2)}), Clause({neg(1), pos(3)}),
+                    Clause({neg(2), neg(3), pos(4)})};
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(s.addClause(clause));
+    }
+
+    ASSERT_TRUE(s.probe());
+    EXPECT_EQ(s.getProfiler().getCount("hyper-binary resolvents"), 1);
+    EXPECT_THAT(s.getBinaryImplications(neg(1)), testing::Contains(pos(4))) << "resolvent must use the dominator x1";
+    EXPECT_THAT(s.getBinaryImplications(neg(0)), testing::Not(testing::Contains(pos(4))));
+}
+
+TEST(solver, remove_clause_garbage_collection) {
+    using namespace sat;
+    Solver s(5);
+    auto clauses = {Clause({neg(0), pos(1), pos(4)}), Clause({neg(1), pos(2), pos(4)}),
+                    Clause({neg(2), pos(3), pos(4)}), Clause({pos(0), pos(1), pos(2)})};
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(s.addClause(clause));
+    }
+
+    s.removeClause(s.getClauseRefs()[1]);
+    s.collectGarbage();
+    EXPECT_EQ(s.getClauseRefs().size(), 3);
+    EXPECT_EQ(s.getProfiler().getCount("garbage collections"), 1);
+    EXPECT_GT(s.getProfiler().getCount("garbage collection bytes reclaimed"), 0);
+    for (auto ref : s.getClauseRefs()) {
+        EXPECT_FALSE(s.getClause(ref).isDeleted());
+    }
+
+    ASSERT_TRUE(s.assign(pos(0)));
+    ASSERT_TRUE(s.assign(neg(4)));
+    ASSERT_TRUE(s.unitPropagate());
+    EXPECT_EQ(s.val(1), TruthValue::True);
+    EXPECT_EQ(s.val(2), TruthValue::Undefined) << "removed clause must not propagate";
+    EXPECT_EQ(s.val(3), TruthValue::Undefined);
+}
+
+TEST(solver, remove_satisfied_clauses) {
+    using namespace sat;
+    Solver s(3);
+    auto clauses = {Clause({neg(1), pos(0), neg(2)}), Clause({neg(1), pos(2)}), Clause({neg(0), neg(2)})};
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(s.addClause(clause));
+    }
+
+    ASSERT_TRUE(s.assign(pos(0)));
+    EXPECT_EQ(s.removeSatisfiedClauses(), 1);
+    const auto rebased = s.rebase();
+    EXPECT_EQ(rebased.size(), 3);
+    EXPECT_TRUE(test::findClause(Clause({neg(1), pos(2)}), rebased));
+}
+
 #ifndef __RUN_ALL_TESTS__
 
 int main(int argc, char **argv) {
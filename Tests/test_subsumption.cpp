@@ -0,0 +1,83 @@
+/**
+* @date 17.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <algorithm>
+#include <vector>
+
+#include "Solver.hpp"
+#include "printing.hpp"
+#include "subsumption.hpp"
+
+TEST(subsumption, signature) {
+    using namespace sat;
+    const std::vector small{pos(1), neg(3)};
+    const std::vector large{neg(1), pos(3), pos(70)};
+    EXPECT_EQ(signature(small) & ~signature(large), 0) << "signatures must not depend on the sign";
+    EXPECT_NE(signature(large) & ~signature(small), 0);
+    EXPECT_EQ(signature(std::vector{pos(6)}), signature(std::vector{pos(70)})) << "variables are hashed modulo 64";
+}
+
+TEST(subsumption, subsume_and_strengthen) {
+    using namespace sat;
+    using Status = Subsumer::Status;
+    Subsumer subsumer(6);
+    const auto c0 = subsumer.add(std::vector{pos(2), pos(0), pos(1)});
+    const auto c1 = subsumer.add(std::vector{pos(0), pos(1)});
+    const auto c2 = subsumer.add(std::vector{pos(3), neg(1), pos(0), pos(4)});
+    const auto c3 = subsumer.add(std::vector{pos(1), pos(0)});
+    const auto c4 = subsumer.add(std::vector{pos(5), neg(2)}, false);
+    const auto c5 = subsumer.add(std::vector{pos(5), neg(2), pos(4)});
+    const auto c6 = subsumer.add(std::vector{neg(3), pos(0)});
+    subsumer.run();
+    EXPECT_EQ(subsumer.getStatus(c0), Status::Subsumed);
+    EXPECT_EQ(subsumer.getStatus(c1), Status::Kept);
+    EXPECT_EQ(subsumer.getStatus(c3), Status::Subsumed) << "duplicates must be subsumed";
+    EXPECT_EQ(subsumer.getStatus(c4), Status::Kept);
+    EXPECT_EQ(subsumer.getStatus(c5), Status::Kept) << "non subsuming clauses must not subsume others";
+    EXPECT_EQ(subsumer.getStatus(c6), Status::Kept);
+    // resolved with c1 on x1 and with c6 on x3
+    EXPECT_EQ(subsumer.getStatus(c2), Status::Strengthened);
+    EXPECT_THAT(subsumer.getLiterals(c2), testing::ElementsAre(pos(0), pos(4)));
+    EXPECT_EQ(subsumer.getNumSubsumed(), 2);
+    EXPECT_EQ(subsumer.getNumStrengthened(), 1);
+    EXPECT_EQ(subsumer.size(), 7);
+}
+
+TEST(subsumption, solver) {
+    using namespace sat;
+    Solver solver(5);
+    ASSERT_TRUE(solver.addClause(Clause({pos(0), pos(1)})));
+    ASSERT_TRUE(solver.addClause(Clause({pos(0), pos(1), pos(2)})));
+    ASSERT_TRUE(solver.addClause(Clause({pos(0), neg(1), pos(3), pos(4)})));
+    ASSERT_TRUE(solver.addClause(Clause({pos(2), neg(3), pos(4), neg(0)})));
+    ASSERT_TRUE(solver.addClause(Clause({pos(2), neg(4)})));
+    ASSERT_TRUE(solver.addClause(Clause({pos(2), pos(4)})));
+    ASSERT_TRUE(solver.subsume());
+    EXPECT_EQ(solver.val(2), TruthValue::True) << "binary clauses must be strengthened to units";
+    std::vector<std::vector<Literal>> remaining;
+    for (auto ref : solver.getClauseRefs()) {
+        const auto c = solver.getClause(ref);
+        if (not c.isDeleted()) {
+            std::vector<Literal> literals(c.begin(), c.end());
+            std::ranges::sort(literals, {}, [](Literal l) { return l.get(); });
+            remaining.emplace_back(std::move(literals));
+        }
+    }
+
+    EXPECT_THAT(remaining, testing::ElementsAre(testing::ElementsAre(pos(0), pos(3), pos(4))));
+    EXPECT_EQ(solver.getProfiler().getCount("subsumed clauses"), 2) << "the unit x2 must subsume a clause";
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
@@ -27,6 +27,13 @@ namespace test {
         static constexpr auto UnitPropagationSolution2 = __TEST_DATA_DIR__ "res2.cnf";
         static constexpr auto UnitPropagationSolution3 = __TEST_DATA_DIR__ "res3.cnf";
         static constexpr auto UnitPropagationSolution4 = __TEST_DATA_DIR__ "res4.cnf";
+        static constexpr auto SatInstances = {__TEST_DATA_DIR__ "../../eval/sat/easy/uf20-0184.cnf",
+                                              __TEST_DATA_DIR__ "../../eval/sat/easy/uf20-0593.cnf",
+                                              __TEST_DATA_DIR__ "../../eval/sat/medium/bw_large.a.cnf"};
+        static constexpr auto UnsatInstances = {__TEST_DATA_DIR__ "../../eval/unsat/easy/uuf50-0413.cnf",
+                                                __TEST_DATA_DIR__ "../../eval/unsat/medium/uuf50-0158.cnf",
+                                                __TEST_DATA_DIR__ "../../eval/unsat/trivial/res3.cnf"};
+        static constexpr auto PigeonHoleProblem = __TEST_DATA_DIR__ "../../eval/unsat/hard/hole8.cnf";
     };
 
     template<typename T>
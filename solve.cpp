@@ -1,5 +1,124 @@
-#include "Solver/inout.hpp"
+#include <fstream>
 #include <iostream>
-int main() {
-    auto problem = sat::inout::read_from_dimacs(std::cin);
+#include <sstream>
+#include <string>
+
+#include "Solver/Solver.hpp"
+#include "Solver/inout.hpp"
+#include "Solver/preprocessing.hpp"
+#include "Solver/util/cli.hpp"
+#include "Solver/util/Profiler.hpp"
+
+/**
+ * Prints the statistics of the solver as comment lines
+ * @param solver solver
+ */
+void printStatistics(const sat::Solver &solver) {
+    std::stringstream ss;
+    const auto &profiler = solver.getProfiler();
+    profiler.printCounts(ss);
+    if (const auto conflicts = profiler.getCount("conflicts"); conflicts > 0) {
+        const auto minimized = static_cast<double>(profiler.getCount("minimized literals"));
+        const auto learnt = static_cast<double>(profiler.getCount("learnt literals"));
+        ss << "minimized literals per conflict: " << minimized / static_cast<double>(conflicts) << " ("
+           << 100 * minimized / (minimized + learnt) << "%)" << std::endl;
+    }
+
+    if (const auto restarts = profiler.getCount("restarts"); restarts > 0) {
+        ss << "conflicts per restart: "
+           << static_cast<double>(profiler.getCount("conflicts")) / static_cast<double>(restarts) << std::endl;
+    }
+
+    profiler.printAll<std::chrono::microseconds>(ss);
+    std::string line;
+    while (std::getline(ss, line)) {
+        std::cout << "c " << line << std::endl;
+    }
+}
+
+/**
+ * Usage: solve <instance> [options]
+ *   --dpll                use DPLL instead of CDCL
+ *   --stats               print the solver statistics
+ *   --no-preprocessing    skip variable elimination, subsumption, probing and substitution
+ *   --heuristic <name>    branching heuristic (vsids, vmtf, lrb, first)
+ *   --restarts <name>     restart policy (glucose, luby, geometric, none)
+ *   --chrono <threshold>  enable chronological backtracking for backjumps over more levels
+ *   --mode-switching      alternate between focused (VMTF, glucose restarts) and stable (VSIDS, Luby restarts) mode.
+ *                         The modes bring their own heuristics and restart policies, so --heuristic and --restarts
+ *                         have no effect
+ */
+int main(int argc, char **argv) {
+    using namespace sat;
+    bool useDpll = false;
+    bool printStats = false;
+    bool modeSwitching = false;
+    bool noPreprocessing = false;
+    unsigned chronoThreshold = Solver::NoChronologicalBacktracking;
+    std::string heuristic = "vsids";
+    std::string restarts = "glucose";
+    const auto instanceFile = cli::parse(argc, argv, cli::Switch("--dpll", useDpll),
+                                         cli::Switch("--stats", printStats),
+                                         cli::Switch("--mode-switching", modeSwitching),
+                                         cli::Switch("--no-preprocessing", noPreprocessing),
+                                         cli::ValueArg("--heuristic", heuristic),
+                                         cli::ValueArg("--restarts", restarts),
+                                         cli::ValueArg("--chrono", chronoThreshold));
+    std::ifstream in(instanceFile);
+    if (not in.is_open()) {
+        std::cerr << "Could not open file " << instanceFile << std::endl;
+        return 1;
+    }
+
+    auto [clauses, numVariables] = inout::read_from_dimacs(in);
+    Solver solver(static_cast<unsigned>(numVariables));
+    solver.setHeuristic(makeHeuristic(heuristic, static_cast<std::size_t>(numVariables)));
+    solver.setRestartPolicy(makeRestartPolicy(restarts));
+    solver.setModeSwitching(modeSwitching);
+    if (modeSwitching) {
+        std::cout << "c -- mode switching replaces the options --heuristic and --restarts" << std::endl;
+    }
+
+    solver.setChronologicalBacktracking(chronoThreshold);
+    bool ok = true;
+    Preprocessor preprocessor(numVariables);
+    if (not noPreprocessing) {
+        StopWatch preprocessingWatch;
+        for (auto &clause : clauses) {
+            ok = preprocessor.addClause(std::move(clause)) && ok;
+        }
+
+        ok = ok && preprocessor.eliminate();
+        clauses = preprocessor.getClauses();
+        std::cout << "c preprocessed in " << preprocessingWatch.elapsed<std::chrono::milliseconds>() << "ms, "
+                  << preprocessor.getNumEliminated() << " of " << numVariables << " variables eliminated"
+                  << std::endl;
+    }
+
+    solver.setClauseDeduplication(true);
+    for (auto &clause : clauses) {
+        ok = solver.addClause(Clause(std::move(clause))) && ok;
+    }
+
+    solver.setClauseDeduplication(false);
+
+    if (ok && not noPreprocessing) {
+        ok = solver.subsume() && solver.probe() && solver.substituteEquivalences();
+    }
+
+    StopWatch watch;
+    const auto n = static_cast<unsigned>(numVariables);
+    const bool satisfiable = ok && (useDpll ? solver.dpll(n) : solver.cdcl(n));
+    std::cout << "c solved in " << watch.elapsed<std::chrono::milliseconds>() << "ms" << std::endl;
+    if (printStats) {
+        printStatistics(solver);
+    }
+
+    if (satisfiable) {
+        std::cout << inout::to_dimacs(preprocessor.getReconstructionStack().extend(solver.getModel(), numVariables));
+    } else {
+        std::cout << "UNSAT" << std::endl;
+    }
+
+    return 0;
 }